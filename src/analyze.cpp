@@ -552,11 +552,27 @@ void Internal::eagerly_subsume_recently_learned_clauses (Clause * c) {
 #ifdef LOGGING
   int64_t before = stats.eagersub;
 #endif
+  // The signatures of the previously learned clauses in 'eager' occur in
+  // the same order as these clauses in 'clauses' (it is cleared during
+  // garbage collection), thus can be matched while walking backwards.
+  //
+  const uint64_t sig = opts.signatures ? signature (c) : 0;
+  size_t j = eager.size ();
   while (it != begin && stats.eagertried++ <= lim) {
     Clause * d =  *--it;
     if (c == d) continue;
+    const bool signed_clause = j && eager[j-1].clause == d;
+    const uint64_t d_sig = signed_clause ? eager[--j].sig : 0;
     if (d->garbage) continue;
     if (!d->redundant) continue;
+    if (signed_clause) {
+      stats.sigchecks++;
+      if (sig & ~d_sig) {
+        stats.sigrejects++;
+        stats.sigsaved += d->size;
+        continue;
+      }
+    }
     int needed = c->size;
     for (auto & lit : *d) {
       if (marked (lit) <= 0) continue;
@@ -569,6 +585,12 @@ void Internal::eagerly_subsume_recently_learned_clauses (Clause * c) {
     mark_garbage (d);
   }
   unmark (c);
+  if (opts.signatures) {
+    eager.push_back (Signed (c, sig));
+    const size_t max_eager = 2 * (size_t) opts.eagersubsumelim + 2;
+    if (eager.size () > max_eager)
+      eager.erase (eager.begin (), eager.end () - max_eager/2);
+  }
 #ifdef LOGGING
   uint64_t subsumed = stats.eagersub - before;
   if (subsumed) LOG ("eagerly subsumed %d clauses", subsumed);
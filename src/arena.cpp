@@ -8,23 +8,43 @@ Arena::Arena (Internal * i) {
 }
 
 Arena::~Arena () {
-  delete [] from.start;
-  delete [] to.start;
+  internal->delete_pages (from.start, from.mapped);
+  internal->delete_pages (to.start, to.mapped);
+  internal->delete_pages (spare.start, spare.mapped);
 }
 
 void Arena::prepare (size_t bytes) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
-  to.top = to.start = new char[bytes];
+  if (spare.start && spare.mapped >= bytes) {
+    LOG ("reusing spare mapped region of %zd bytes", spare.mapped);
+    to.start = spare.start;
+    to.mapped = spare.mapped;
+  } else {
+    if (spare.start) {
+      LOG ("deleting too small spare region of %zd bytes", spare.mapped);
+      internal->delete_pages (spare.start, spare.mapped);
+    }
+    to.start = internal->new_pages (bytes, to.mapped);
+  }
+  spare.start = 0;
+  spare.mapped = 0;
+  to.top = to.start;
   to.end = to.start + bytes;
 }
 
 void Arena::swap () {
-  delete [] from.start;
   LOG ("delete 'from' space of arena with %zd bytes",
     (size_t) (from.end - from.start));
+  if (from.mapped) {
+    assert (!spare.start);
+    internal->release_pages (from.start, from.mapped);
+    spare.start = from.start;
+    spare.mapped = from.mapped;
+  } else internal->delete_pages (from.start, from.mapped);
   from = to;
   to.start = to.top = to.end = 0;
+  to.mapped = 0;
 }
 
 }
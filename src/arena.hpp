@@ -51,13 +51,27 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// Both semi-spaces are allocated with 'Internal::new_pages' and thus might
+// be backed by transparent huge pages (see 'pages.hpp').  If the 'from'
+// space was memory mapped, 'swap' does not unmap it but only releases its
+// physical pages and keeps it as 'spare' region, which is reused by the
+// next 'prepare' if it is large enough.
+
 struct Internal;
 
 class Arena {
 
   Internal * internal;
 
-  struct { char * start, * top, * end; } from, to;
+  struct {
+    char * start, * top, * end;
+    size_t mapped;              // mapped bytes (zero if not mapped)
+  } from, to;
+
+  struct {
+    char * start;               // released old 'from' space
+    size_t mapped;              // and its mapped size
+  } spare;
 
 public:
 
@@ -70,6 +84,21 @@ public:
   //
   void prepare (size_t bytes);
 
+  // Used bytes are those of clauses in 'from' space (and 'to' space during
+  // garbage collection), while reserved bytes are all allocated bytes.  The
+  // released 'spare' region has no physical pages and is not counted.
+  //
+  size_t used_bytes () const {
+    return (from.top - from.start) + (to.top - to.start);
+  }
+
+  size_t reserved_bytes () const {
+    size_t res = 0;
+    res += from.mapped ? from.mapped : from.end - from.start;
+    res += to.mapped ? to.mapped : to.end - to.start;
+    return res;
+  }
+
   // Does the memory pointed to by 'p' belong to this arena? More precisely
   // to the 'from' space, since that is the only one remaining after 'swap'.
   //
@@ -91,9 +120,20 @@ public:
     return res;
   }
 
-  // Completely delete 'from' space and then replace 'from' by 'to' (by
-  // pointer swapping).  Everything previously allocated (in 'from') and not
-  // explicitly copied to 'to' with 'copy' becomes invalid.
+  // Allocate that amount of memory in 'to' space without copying.  This is
+  // used by the parallel copying collector, which copies clauses to their
+  // precomputed offsets in the allocated block concurrently.
+  //
+  char * allocate (size_t bytes) {
+    char * res = to.top;
+    to.top += bytes;
+    assert (to.top <= to.end);
+    return res;
+  }
+
+  // Completely delete (or release) 'from' space and then replace 'from'
+  // by 'to' (by pointer swapping).  Everything previously allocated (in
+  // 'from') and not explicitly copied to 'to' with 'copy' becomes invalid.
   //
   void swap ();
 };
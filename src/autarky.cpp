@@ -0,0 +1,238 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// An autarky is a partial assignment which satisfies every clause in which
+// one of its variables occurs.  All these clauses can be removed without
+// changing satisfiability and then the variables of the autarky do not
+// occur anymore.  We compute a maximal autarky contained in the current
+// saved phases (which after local search are the phases of the best
+// assignment found) by iterative refinement.  Starting with the full
+// assignment given by the phases, every irredundant clause not satisfied
+// by the current assignment makes its falsified variables unassigned,
+// which in turn might make other clauses unsatisfied.  The fix-point is
+// the largest autarky contained in the initial assignment.  Frozen
+// variables are kept out of the autarky, since they might occur in future
+// clauses or assumptions.  Removed clauses are pushed on the extension
+// stack and the variables of the autarky are marked as pure literals.
+//
+// For reconstruction it is not enough to use a single autarky literal as
+// witness for every removed clause, since flipping it could falsify other
+// removed clauses containing its negation ('mixed' clauses).  Clauses
+// without any negated autarky literal are pushed last (thus reconstructed
+// first) with one autarky literal as witness, since flipping literals to
+// their autarky value can not falsify them.  The mixed clauses use all the
+// autarky literals of variables in mixed clauses as witness.  The first
+// falsified mixed clause during reconstruction flips all of them, which
+// then satisfies all the remaining mixed clauses.  To bound the size of
+// the extension stack the variables of mixed clauses are removed from the
+// autarky and the refinement is continued if these witnesses would become
+// too large.
+
+bool Internal::autarkying () {
+  if (!opts.simplify) return false;
+  if (!opts.autarky) return false;
+  if (unsat) return false;
+  if (terminating ()) return false;
+  if (!stats.current.irredundant) return false;
+  return last.autarky.irredundant != stats.added.irredundant;
+}
+
+void Internal::autarky () {
+
+  assert (autarkying ());
+  assert (!level);
+  assert (watching ());
+
+  if (!propagate ()) { learn_empty_clause (); return; }
+
+  reset_cards ();
+
+  assert (!preprocessing);
+  preprocessing = true;
+  START_SIMPLIFIER (autarky, AUTARKY);
+  stats.autarkies++;
+
+  init_occs ();
+
+  // Only consider irredundant clauses without root level satisfied
+  // literals.  Root level falsified literals are simply ignored below.
+  //
+  auto root_satisfied = [&] (Clause * c) {
+    for (const auto & lit : *c)
+      if (val (lit) > 0) return true;
+    return false;
+  };
+
+  vector<Clause *> candidates;
+  for (const auto & c : clauses) {
+    if (c->garbage || c->redundant) continue;
+    if (root_satisfied (c)) continue;
+    candidates.push_back (c);
+    for (const auto & lit : *c)
+      occs (lit).push_back (c);
+  }
+
+  // Initial assignment given by the saved phases of active variables.
+  //
+  vector<signed char> values (max_var + 1, 0);
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (!active (idx)) continue;
+    if (frozen (idx)) continue;
+    if (occs (idx).empty () && occs (-idx).empty ()) continue;
+    values[idx] = phases.saved[idx];
+  }
+
+  auto value = [&] (int lit) {
+    const signed char tmp = values[abs (lit)];
+    return lit < 0 ? -tmp : tmp;
+  };
+
+  // Unassign falsified literals of clauses not satisfied by the autarky.
+  // The retracted (previously true) literals are pushed on a work list.
+  //
+  vector<int> retracted;
+  auto refine = [&] (Clause * c) {
+    for (const auto & lit : *c)
+      if (value (lit) > 0) return;
+    for (const auto & lit : *c) {
+      if (value (lit) >= 0) continue;
+      LOG (c, "retracting %d from autarky due to", -lit);
+      values[abs (lit)] = 0;
+      retracted.push_back (-lit);
+    }
+  };
+
+  for (const auto & c : candidates)
+    refine (c);
+
+  vector<Clause *> mixed, positive;
+  vector<int> witness;
+
+  for (;;) {
+
+    while (!retracted.empty ()) {
+      const int lit = retracted.back ();
+      retracted.pop_back ();
+      for (const auto & c : occs (lit))
+        refine (c);
+    }
+
+    // Partition the clauses touched by the autarky.
+    //
+    mixed.clear ();
+    positive.clear ();
+    for (const auto & c : candidates) {
+      bool touched = false, negative = false;
+      for (const auto & lit : *c) {
+        const signed char tmp = value (lit);
+        if (tmp > 0) touched = true;
+        if (tmp < 0) negative = true;
+      }
+      if (!touched) continue;
+      if (negative) mixed.push_back (c);
+      else positive.push_back (c);
+    }
+
+    // Witness of mixed clauses consists of all autarky literals of their
+    // variables (stamped through 'marks').
+    //
+    witness.clear ();
+    for (const auto & c : mixed)
+      for (const auto & lit : *c) {
+        if (!value (lit)) continue;
+        if (marked (lit)) continue;
+        const int autarky_lit = value (lit) > 0 ? lit : -lit;
+        mark (lit);
+        witness.push_back (autarky_lit);
+      }
+    for (const auto & lit : witness)
+      unmark (lit);
+
+    const double size = (double) mixed.size () * witness.size ();
+    if (size <= opts.autarkywitlim) break;
+
+    PHASE ("autarky", stats.autarkies,
+      "retracting %zd variables of %zd mixed clauses",
+      witness.size (), mixed.size ());
+
+    for (const auto & lit : witness) {
+      values[abs (lit)] = 0;
+      retracted.push_back (lit);
+    }
+  }
+
+  int64_t vars = 0;
+  for (int idx = 1; idx <= max_var; idx++)
+    if (values[idx]) vars++;
+
+  int64_t removed = 0;
+
+  if (vars) {
+
+    // Mixed clauses first, such that they are reconstructed last.
+    //
+    for (const auto & c : mixed) {
+      LOG (c, "autarky removes mixed");
+      external->push_zero_on_extension_stack ();
+      for (const auto & lit : witness)
+        external->push_witness_literal_on_extension_stack (lit);
+      external->push_clause_on_extension_stack (c);
+      mark_garbage (c);
+      removed++;
+    }
+
+    for (const auto & c : positive) {
+      int autarky_lit = 0;
+      for (const auto & lit : *c)
+        if (value (lit) > 0) { autarky_lit = lit; break; }
+      assert (autarky_lit);
+      LOG (c, "autarky literal %d removes", autarky_lit);
+      external->push_clause_on_extension_stack (c, autarky_lit);
+      mark_garbage (c);
+      removed++;
+    }
+
+    // Remaining clauses with autarky variables are either redundant or
+    // root level satisfied and can be dropped without further ado.
+    //
+    for (const auto & c : clauses) {
+      if (c->garbage) continue;
+      bool touched = false;
+      for (const auto & lit : *c)
+        if (value (lit)) { touched = true; break; }
+      if (!touched) continue;
+      assert (c->redundant || root_satisfied (c));
+      mark_garbage (c);
+    }
+
+    for (int idx = 1; idx <= max_var; idx++) {
+      if (!values[idx]) continue;
+      LOG ("autarky literal %d", values[idx] * idx);
+      mark_pure (idx);
+    }
+
+    stats.autarkyvars += vars;
+    stats.autarkyclauses += removed;
+  }
+
+  reset_occs ();
+
+  PHASE ("autarky", stats.autarkies,
+    "found autarky of %" PRId64 " variables removing %" PRId64 " clauses",
+    vars, removed);
+
+  last.autarky.irredundant = stats.added.irredundant;
+
+  if (vars) garbage_collection ();
+
+  STOP_SIMPLIFIER (autarky, AUTARKY);
+  assert (preprocessing);
+  preprocessing = false;
+
+  report ('A', !opts.reportall && !vars);
+}
+
+}
@@ -0,0 +1,122 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Backbone extraction.  The backbone consists of all literals which are
+// true in every model of the formula.  Starting from a first model, all
+// literals true in it are candidates.  Every further model found removes
+// the candidates which are false in it ('model-based filtering').  Root
+// level units are backbone literals without any further check.
+//
+// Instead of checking candidates one by one we assume the negation of a
+// whole chunk of candidates at once.  If this is satisfiable all of them
+// are filtered (and the chunk size is doubled).  Otherwise the failed
+// assumptions give a core.  If the core consists of only one literal its
+// negation is in the backbone.  Otherwise the core literals are moved to
+// the front and checked individually (the chunk size is reset to one).
+//
+// All checks are incremental calls to the same solver and thus share
+// learned clauses.  Optionally backbone literals are added as unit
+// clauses, which are implied by the formula and thus do not change the
+// set of models, but help subsequent checks.
+
+/*------------------------------------------------------------------------*/
+
+int External::backbone (vector<int> & lits, bool add) {
+
+  assert (assumptions.empty ());
+  lits.clear ();
+
+  Stats & stats = internal->stats;
+  stats.backbones++;
+  stats.backbonecalls++;
+
+  int res = solve ();
+  if (res != 10) return res;
+
+  vector<int> candidates;
+  for (const auto & idx : evars) {
+    if (!e2i[idx]) continue;
+    candidates.push_back (ival (idx));
+  }
+
+  LOG ("backbone extraction with %zd candidates", candidates.size ());
+
+  const size_t max_chunk = internal->opts.backbonechunk;
+  size_t chunk = 1;
+
+  while (res && !candidates.empty ()) {
+
+    // Remove candidates fixed at the root level.
+    //
+    auto j = candidates.begin ();
+    for (const auto & lit : candidates) {
+      const int tmp = fixed (lit);
+      assert (tmp >= 0);
+      if (tmp > 0) lits.push_back (lit);
+      else *j++ = lit;
+    }
+    candidates.resize (j - candidates.begin ());
+    if (candidates.empty ()) break;
+
+    const size_t size = min (chunk, candidates.size ());
+    reset_assumptions ();
+    for (size_t i = 0; i < size; i++)
+      assume (-candidates[i]);
+
+    stats.backbonecalls++;
+    res = solve ();
+
+    if (res == 10) {
+
+      // Model-based filtering removes at least the whole chunk.
+      //
+      j = candidates.begin ();
+      for (const auto & lit : candidates)
+        if (ival (lit) > 0) *j++ = lit;
+      candidates.resize (j - candidates.begin ());
+      chunk = min (2*chunk, max_chunk);
+
+    } else if (res == 20) {
+
+      // Move the core to the front.
+      //
+      size_t core = 0;
+      for (size_t i = 0; i < size; i++)
+        if (failed (-candidates[i]))
+          swap (candidates[core++], candidates[i]);
+
+      if (!core) {              // Formula itself is unsatisfiable.
+        reset_assumptions ();
+        lits.clear ();
+        return 20;
+      }
+
+      if (core == 1) {
+        const int lit = candidates[0];
+        LOG ("backbone literal %d", lit);
+        lits.push_back (lit);
+        candidates.erase (candidates.begin ());
+        if (add) {
+          reset_assumptions ();
+          External::add (lit);
+          External::add (0);
+        }
+      } else chunk = 1;
+    }
+  }
+
+  reset_assumptions ();
+  stats.backbonelits += lits.size ();
+
+  sort (lits.begin (), lits.end (),
+    [] (int a, int b) { return abs (a) < abs (b); });
+
+  LOG ("found %zd backbone literals", lits.size ());
+
+  return res ? 10 : 0;
+}
+
+}
@@ -43,6 +43,7 @@ void Internal::elim_backward_clause (Eliminator & eliminator, Clause *c) {
   unsigned size = 0;
   int best = 0;
   bool satisfied = false;
+  uint64_t sig = 0;
   for (const auto & lit : *c) {
     const signed char tmp = val (lit);
     if (tmp > 0) { satisfied = true; break; }
@@ -50,6 +51,7 @@ void Internal::elim_backward_clause (Eliminator & eliminator, Clause *c) {
     size_t l = occs (lit).size ();
     LOG ("literal %d occurs %zd times", lit, l);
     if (l < len) best = lit, len = l;
+    sig |= signature_bit (lit);
     mark (lit);
     size++;
   }
@@ -63,10 +65,22 @@ void Internal::elim_backward_clause (Eliminator & eliminator, Clause *c) {
     assert (len);
     LOG ("literal %d has smallest number of occurrences %zd", best, len);
     LOG ("marked %d literals in clause of size %d", size, c->size);
-    for (auto & d : occs (best)) {
+    const Occs & os = occs (best);
+    for (size_t i = 0; i < os.size (); i++) {
+      Clause * d = os[i];
       if (d == c) continue;
       if (d->garbage) continue;
       if ((unsigned) d->size < size) continue;
+      if (signing ()) {
+        // Strengthening might leave stale bits but never misses bits.
+        assert (!(signature (d) & ~sigs (best)[i]));
+        stats.sigchecks++;
+        if (sig & ~sigs (best)[i]) {
+          stats.sigrejects++;
+          stats.sigsaved += d->size;
+          continue;
+        }
+      }
       int negated = 0;
       unsigned found = 0;
       for (const auto & lit : *d) {
@@ -114,7 +128,8 @@ void Internal::elim_backward_clause (Eliminator & eliminator, Clause *c) {
             break;
           } else if (occs (negated).size () <= (size_t) opts.elimocclim) {
             strengthen_clause (d, negated);
-            remove_occs (occs (negated), d);
+            if (signing ()) remove_occs (occs (negated), sigs (negated), d);
+            else remove_occs (occs (negated), d);
             elim_update_removed_lit (eliminator, negated);
             stats.elimbwstr++;
             assert (negated != best);
@@ -19,4 +19,53 @@ void Internal::reset_bins () {
   LOG ("reset binary implication graph");
 }
 
+/*------------------------------------------------------------------------*/
+
+// Build a CSR snapshot of the binary implication graph in two passes over
+// the clauses.  The first pass counts the out-degree of each literal and
+// after computing prefix sums the second pass fills the edges backwards,
+// which moves each offset back to the start of its literal and at the same
+// time keeps the edges of a literal in the order of 'clauses'.  The binary
+// clause '(a,b)' gives the two implication edges '-a -> b' and '-b -> a'.
+// Optionally redundant binary clauses are skipped.
+
+void Internal::init_bin_graph (BinGraph & g, bool irredundant_only) {
+
+  const unsigned size = 2*(max_var + 1);
+  auto & offsets = g.offsets;
+  offsets.assign (size + 1, 0);
+
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    if (c->size != 2) continue;
+    if (irredundant_only && c->redundant) continue;
+    offsets[vlit (-c->literals[0])]++;
+    offsets[vlit (-c->literals[1])]++;
+  }
+
+  size_t sum = 0;
+  for (unsigned u = 0; u <= size; u++)
+    offsets[u] = (sum += offsets[u]);
+
+  auto & edges = g.edges;
+  edges.resize (sum);
+
+  const auto begin = clauses.begin ();
+  auto i = clauses.end ();
+  while (i != begin) {
+    Clause * c = *--i;
+    if (c->garbage) continue;
+    if (c->size != 2) continue;
+    if (irredundant_only && c->redundant) continue;
+    const int lit = c->literals[0], other = c->literals[1];
+    edges[--offsets[vlit (-lit)]] = { other, c };
+    edges[--offsets[vlit (-other)]] = { lit, c };
+  }
+  assert (!offsets[0]);
+  assert (offsets[size] == sum);
+
+  LOG ("initialized binary implication graph snapshot with %zd edges",
+    sum);
+}
+
 }
@@ -12,6 +12,35 @@ typedef vector<int> Bins;
 inline void shrink_bins (Bins & bs) { shrink_vector (bs); }
 inline void erase_bins (Bins & bs) { erase_vector (bs); }
 
+struct Clause;
+
+// Read-only snapshot of the binary implication graph in compressed sparse
+// row (CSR) format.  The edges of all literals are stored in one contiguous
+// array and 'offsets[u]' gives the first edge of the literal with 'vlit'
+// index 'u'.  Its edges end where the edges of the next literal start.
+// Compared to traversing watches this saves the indirection through
+// per-literal vectors and skipping of large clause watches.  It is only
+// valid as long as no binary clause is added or watches are flushed.
+
+struct Bin {
+  int lit;              // implied literal
+  Clause * clause;      // binary clause implying it
+};
+
+struct BinGraph {
+
+  vector<size_t> offsets;
+  vector<Bin> edges;
+
+  const Bin * begin (unsigned u) const { return edges.data () + offsets[u]; }
+  const Bin * end (unsigned u) const {
+    return edges.data () + offsets[u + 1];
+  }
+  size_t size (unsigned u) const { return offsets[u + 1] - offsets[u]; }
+
+  void erase () { erase_vector (offsets); erase_vector (edges); }
+};
+
 }
 
 #endif
@@ -0,0 +1,292 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Bounded variable addition following the 'SimpleBVA' algorithm of Manthey,
+// Heule and Biere.  It is the inverse of bounded variable elimination.  If
+// the clauses 'l_i | C_j' for all 'i' in '1..m' and 'j' in '1..n' are
+// present we add a fresh variable 'x' and replace these 'm*n' clauses by
+// the 'm' clauses 'x | l_i' and the 'n' clauses '-x | C_j'.  Resolving the
+// new clauses on 'x' gives back the replaced ones.  This is particularly
+// effective on pairwise encodings of at-most-one constraints, which are
+// turned into a linear sized encoding with additional variables.
+//
+// The fresh variables have to be visible externally, since proofs, the
+// extension stack and compacting all work with external literals.  They
+// are allocated after the current maximum external variable and thus
+// increase 'Solver::vars'.  These external variables are then reserved by
+// the solver and using them later in 'add', 'assume', 'freeze' or 'melt'
+// is a fatal error (see 'External::introduce').  Therefore this technique
+// is disabled by default and should only be enabled if the user either
+// does not add new variables later or allocates them after 'vars'.
+//
+// Since the replaced clauses are implied by the new ones there is no need
+// to save them on the extension stack.  The fresh variable is assigned
+// during search like any other variable and thus usually gets a value
+// consistent with the original formula in a model.  We still push the
+// clauses 'x | l_i' with witness 'x' on the extension stack, which defines
+// 'x' in terms of the original literals, such that 'extend' always
+// produces a complete model even if the fresh variable is not assigned.
+// In the proof we first add the clauses 'x | l_i', which are RAT on the
+// fresh literal 'x' (there are no clauses with '-x' yet), then the clauses
+// '-x | C_j', which are RAT on '-x' since all resolvents on 'x' are
+// present, and finally delete the replaced clauses.  Therefore the fresh
+// literal is always put first.
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::bvaing () {
+  if (!opts.bva) return false;
+  if (unsat) return false;
+  if (terminating ()) return false;
+  return last.bva.irredundant != stats.added.irredundant;
+}
+
+int Internal::bva_fresh_variable () {
+  assert (!level);
+  const int idx = external->introduce ();
+  assert (0 < idx), assert (idx == max_var);
+  assert (active (idx));
+  init_occs ();                         // Might have been enlarged.
+  stats.bvavars++;
+  LOG ("fresh variable %d (external %d)", idx, externalize (idx));
+  return idx;
+}
+
+// Find the clause 'D = C \ {lit} | other' in the occurrence list of
+// 'other' assuming the literals of 'C' except 'lit' are marked.
+
+Clause * Internal::bva_find_clause (Clause * c, int other) {
+  for (const auto & d : occs (other)) {
+    if (d->garbage) continue;
+    if (d->size != c->size) continue;
+    bool found = true;
+    for (const auto & lit : *d)
+      if (lit != other && marked (lit) <= 0) { found = false; break; }
+    if (found) return d;
+  }
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Try to find a set of literals 'lits' including 'lit' and a set of
+// clauses 'matched' all containing 'lit' which would be replaced as
+// described above and reduce the number of clauses.
+
+bool Internal::bva_lit (int lit, int64_t & effort) {
+
+  vector<int> lits;
+  lits.push_back (lit);
+
+  vector<Clause *> matched;
+  for (const auto & c : occs (lit))
+    if (!c->garbage) matched.push_back (c);
+
+  vector<pair<int, Clause *>> pairs;
+
+  for (;;) {
+
+    if (effort < 0) break;
+
+    // For each matched clause 'C' find all clauses 'D' which differ from
+    // 'C' only in one literal 'other' instead of 'lit'.  It is enough to
+    // go over the occurrences of the literal of 'C' with fewest occurrences.
+    //
+    pairs.clear ();
+    for (const auto & c : matched) {
+      int min_lit = 0;
+      size_t min_occs = 0;
+      for (const auto & other : *c) {
+        if (other == lit) continue;
+        mark (other);
+        const size_t tmp = occs (other).size ();
+        if (min_lit && min_occs <= tmp) continue;
+        min_lit = other;
+        min_occs = tmp;
+      }
+      assert (min_lit);
+      for (const auto & d : occs (min_lit)) {
+        effort -= 1 + d->size;
+        if (d == c || d->garbage || d->size != c->size) continue;
+        int other = 0;
+        for (const auto & tmp : *d) {
+          if (marked (tmp) > 0) continue;
+          if (other) { other = INT_MIN; break; }
+          other = tmp;
+        }
+        if (!other || other == INT_MIN || other == -lit) continue;
+        if (find (lits.begin (), lits.end (), other) != lits.end ())
+          continue;
+        pairs.push_back (make_pair (other, c));
+      }
+      for (const auto & other : *c)
+        if (other != lit) unmark (other);
+    }
+
+    if (pairs.empty ()) break;
+
+    // Pairs of the same clause 'C' are generated consecutively and thus
+    // stay adjacent after stable sorting which allows to remove duplicates.
+    //
+    stable_sort (pairs.begin (), pairs.end (),
+      [] (const pair<int, Clause *> & a, const pair<int, Clause *> & b) {
+        return a.first < b.first;
+      });
+    pairs.resize (unique (pairs.begin (), pairs.end ()) - pairs.begin ());
+
+    int best = 0;
+    size_t best_count = 0;
+    for (auto i = pairs.begin (), j = i; i != pairs.end (); i = j) {
+      while (j != pairs.end () && j->first == i->first) j++;
+      const size_t count = j - i;
+      if (count <= best_count) continue;
+      best = i->first;
+      best_count = count;
+    }
+
+    const int64_t m = lits.size (), n = matched.size ();
+    const int64_t before = m*n - m - n;
+    const int64_t after = (m + 1)*best_count - (m + 1) - best_count;
+    if (after <= before) break;
+
+    LOG ("adding %d to %zd literals matching %zd clauses",
+      best, lits.size (), best_count);
+    lits.push_back (best);
+    matched.clear ();
+    for (const auto & p : pairs)
+      if (p.first == best) matched.push_back (p.second);
+  }
+
+  const int64_t m = lits.size (), n = matched.size ();
+  const int64_t reduction = m*n - m - n;
+  if (reduction <= 0) return false;
+
+  const int idx = bva_fresh_variable ();
+
+  LOG ("replacing %" PRId64 " by %" PRId64 " clauses with variable %d",
+    m*n, m + n, idx);
+
+  // First the binary clauses 'idx | l_i' ...
+  //
+  for (const auto & other : lits) {
+    assert (clause.empty ());
+    clause.push_back (idx);
+    clause.push_back (other);
+    Clause * d = new_clause (false);
+    if (proof) proof->add_derived_clause (d);
+    watch_clause (d);
+    for (const auto & tmp : *d) occs (tmp).push_back (d);
+    external->push_clause_on_extension_stack (d, idx);
+    clause.clear ();
+  }
+
+  // ... then the clauses '-idx | C_j' and the replaced clauses.
+  //
+  for (const auto & c : matched) {
+    assert (clause.empty ());
+    clause.push_back (-idx);
+    for (const auto & other : *c)
+      if (other != lit) clause.push_back (other);
+    Clause * d = new_clause (false);
+    if (proof) proof->add_derived_clause (d);
+    watch_clause (d);
+    for (const auto & tmp : *d) occs (tmp).push_back (d);
+    clause.clear ();
+  }
+
+  int64_t removed = 0;
+  for (const auto & c : matched) {
+    for (const auto & other : *c)
+      if (other != lit) mark (other);
+    for (const auto & other : lits) {
+      Clause * d = (other == lit) ? c : bva_find_clause (c, other);
+      if (!d || d->garbage) continue;   // Duplicated clauses.
+      mark_garbage (d);
+      removed++;
+    }
+    for (const auto & other : *c)
+      if (other != lit) unmark (other);
+  }
+
+  stats.bvaadded += m + n;
+  stats.bvaremoved += removed;
+
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::bva () {
+
+  assert (bvaing ());
+  assert (!level);
+  assert (watching ());
+  assert (cards.empty ());
+
+  if (!propagate ()) { learn_empty_clause (); return; }
+
+  assert (preprocessing);
+  START_SIMPLIFIER (bva, BVA);
+  stats.bva++;
+
+  init_occs ();
+
+  // Only consider irredundant clauses without root level assigned literals.
+  //
+  for (const auto & c : clauses) {
+    if (c->garbage || c->redundant) continue;
+    bool assigned = false;
+    for (const auto & lit : *c)
+      if (val (lit)) { assigned = true; break; }
+    if (assigned) continue;
+    for (const auto & lit : *c)
+      occs (lit).push_back (c);
+  }
+
+  vector<int> schedule;
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (!active (idx)) continue;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if (occs (lit).size () > 1) schedule.push_back (lit);
+    }
+  }
+
+  stable_sort (schedule.begin (), schedule.end (), [&] (int a, int b) {
+    return occs (a).size () > occs (b).size ();
+  });
+
+  PHASE ("bva", stats.bva,
+    "scheduled %zd literals for variable addition", schedule.size ());
+
+  const int64_t old_vars = stats.bvavars;
+  const int64_t old_removed = stats.bvaremoved;
+  const int64_t old_added = stats.bvaadded;
+
+  int64_t effort = opts.bvamaxeff;
+  for (const auto & lit : schedule) {
+    if (effort < 0 || terminating ()) break;
+    while (effort >= 0 && bva_lit (lit, effort))
+      ;
+  }
+
+  reset_occs ();
+
+  const int64_t vars = stats.bvavars - old_vars;
+  const int64_t removed = stats.bvaremoved - old_removed;
+  const int64_t added = stats.bvaadded - old_added;
+
+  PHASE ("bva", stats.bva,
+    "added %" PRId64 " variables and replaced %" PRId64
+    " by %" PRId64 " clauses", vars, removed, added);
+
+  last.bva.irredundant = stats.added.irredundant;
+
+  STOP_SIMPLIFIER (bva, BVA);
+  report ('a', !opts.reportall && !vars);
+}
+
+}
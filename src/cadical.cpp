@@ -36,6 +36,7 @@ class App : public Handler, public Terminator {
 
   void print_usage (bool all = false);
   void print_witness (FILE *);
+  void print_backbone (FILE *, const vector<int> &);
 
   // Option handling.
 
@@ -74,6 +75,7 @@ void App::print_usage (bool all) {
 "  --version      print version\n"
 "\n"
 "  -n             do not print witness%s\n"
+"  -b             print backbone after solving%s\n"
 #ifndef QUIET
 "  -v             increase verbosity%s\n"
 "  -q             be quiet%s\n"
@@ -82,6 +84,7 @@ void App::print_usage (bool all) {
 "  -t <sec>       set wall clock time limit\n"
 ,
   all ? " (same as '--no-witness')": ""
+  , all ? " (same as '--backbone')": ""
 #ifndef QUIET
   , all ? " (see also '--verbose')": ""
   , all ? " (same as '--quiet')" : ""
@@ -199,6 +202,25 @@ void App::print_witness (FILE * file) {
   if (c) fputc ('\n', file);
 }
 
+// Print backbone literals in the same format with 'b' lines.
+//
+void App::print_backbone (FILE * file, const vector<int> & lits) {
+  int c = 0;
+  size_t i = 0;
+  int tmp;
+  do {
+    if (!c) fputc ('b', file), c = 1;
+    tmp = (i < lits.size ()) ? lits[i++] : 0;
+    char str[20];
+    sprintf (str, " %d", tmp);
+    int l = strlen (str);
+    if (c + l > 78) fputs ("\nb", file), c = 1;
+    fputs (str, file);
+    c += l;
+  } while (tmp);
+  if (c) fputc ('\n', file);
+}
+
 /*------------------------------------------------------------------------*/
 
 // Wrapper around option setting.
@@ -222,7 +244,7 @@ int App::main (int argc, char ** argv) {
   int i, res = 0, optimize = 0, preprocessing = 0, localsearch = 0;
   bool proof_specified = false, dimacs_specified = false;
   int conflict_limit = -1, decision_limit = -1;
-  bool witness = true, less = false;
+  bool witness = true, less = false, backbone = false;
   const char * dimacs_name, * err;
   for (i = 1; i < argc; i++) {
     if (!strcmp (argv[i], "-h")) {
@@ -282,6 +304,9 @@ int App::main (int argc, char ** argv) {
              !strcmp (argv[i], "--witness=false") ||
              !strcmp (argv[i], "--witness=0"))
       witness = false;
+    else if (!strcmp (argv[i], "-b") ||
+             !strcmp (argv[i], "--backbone"))
+      backbone = true;
     else if (!strcmp (argv[i], "--less")) {             // EXPERIMENTAL!
       if (less) APPERR ("multiple '--less' options");
       else if (!isatty (1))
@@ -518,6 +543,13 @@ int App::main (int argc, char ** argv) {
       fflush (stdout);
       print_witness (stdout);
     }
+    if (backbone) {
+      vector<int> lits;
+      fflush (stdout);
+      if (!solver->backbone (lits))
+        solver->message ("backbone extraction interrupted");
+      print_backbone (stdout, lits);
+    }
   } else if (res == 20) printf ("s UNSATISFIABLE\n");
   else printf ("c UNKNOWN\n");
   fflush (stdout);
@@ -193,6 +193,7 @@ struct External;
 class Terminator;
 class ClauseIterator;
 class WitnessIterator;
+class MemoryIterator;
 
 /*------------------------------------------------------------------------*/
 
@@ -494,6 +495,23 @@ public:
 
   //------------------------------------------------------------------------
 
+  // Compute the backbone of the formula, i.e., all literals which are true
+  // in every model.  Returns '10' and the backbone literals sorted by
+  // variable index in 'lits' if the formula is satisfiable, '20' if it is
+  // unsatisfiable (and 'lits' is empty) or '0' if interrupted, in which
+  // case 'lits' contains the backbone literals found so far.  This uses
+  // repeated incremental 'solve' calls with chunks of assumptions (see
+  // 'backbonechunk' option).  If 'add' is true backbone literals are also
+  // added as unit clauses.  These are implied by the formula and thus do
+  // not change its models.  Assumptions are not supported.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN | UNSATISFIED)
+  //
+  int backbone (std::vector<int> & lits, bool add = false);
+
+  //------------------------------------------------------------------------
+
   // Enables clausal proof tracing in DRAT format and returns 'true' if
   // successfully opened for writing.  Writing proofs has to be enabled
   // before calling 'solve', 'add' and 'dimacs', that is in state
@@ -535,6 +553,19 @@ public:
   //
   void options ();      // print current option and value list
 
+  //------------------------------------------------------------------------
+  // Memory used by the solver in bytes.  The first function returns the
+  // total number of reserved (allocated) bytes.  The second one traverses
+  // the used and reserved bytes of each subsystem (arena, clauses, watches
+  // etc.).  Both only need one pass over variables and clauses and are
+  // cheap enough to be called regularly, e.g., before each 'solve' call.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  size_t memory_usage () const;
+  bool traverse_memory_usage (MemoryIterator &) const;
+
   //------------------------------------------------------------------------
   // Traverse irredundant clauses or the extension stack in reverse order.
   //
@@ -764,6 +795,21 @@ public:
 
 /*------------------------------------------------------------------------*/
 
+// Allows to traverse the memory usage of the solver per subsystem.  Used
+// bytes are those actually holding data, while reserved bytes also include
+// unused capacity of allocated memory.
+//
+// If 'memory' returns false traversal can abort early.
+
+class MemoryIterator {
+public:
+  virtual ~MemoryIterator () { }
+  virtual bool memory (const char * subsystem,
+                       size_t used, size_t reserved) = 0;
+};
+
+/*------------------------------------------------------------------------*/
+
 }
 
 #endif
@@ -0,0 +1,256 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Native at-most-one constraints.  Pairwise encodings of at-most-one
+// constraints produce a quadratic number of binary clauses, which all have
+// to be watched and traversed during propagation.  We find cliques in the
+// graph where two literals are connected if their negations form an
+// irredundant binary clause.  Each clique gives an at-most-one constraint
+// over its literals.  The binary clauses covered by such a constraint stay
+// in 'clauses' but are not watched anymore and flagged with 'card'.
+// Instead 'propagate_cards' in 'propagate.cpp' assigns all other literals
+// of a constraint to false as soon one literal becomes true.
+//
+// The reason for such an assignment is the covered binary clause, which is
+// materialized in the reason table 'rtab' of the assigned variable.  Since
+// a variable has at most one reason at a time this table can be reused.
+// These reasons are justified by the original binary clauses, which thus
+// remain part of the proof while the constraints are used.
+//
+// The constraints are only used during search.  Before any procedure which
+// removes clauses or variables (probing, subsumption, elimination,
+// conditioning and compacting) they are dropped again and the covered
+// binary clauses are watched again in 'reset_cards'.  After these
+// procedures return to search we detect constraints again.
+//
+// Note that the scope of this technique is narrow.  Only pairwise encoded
+// at-most-one constraints are detected and general at-most-k constraints
+// (for instance encoded with sequential counters) are not.  Propagation
+// does not use counter based watches either.  For at-most-one constraints
+// this would not help much anyhow, since as soon one literal becomes true
+// all the other literals have to be visited and assigned to false.  Thus
+// 'propagate_cards' just scans the constraints of the assigned literal.
+// As the benefit is limited to formulas with large cliques of binary
+// clauses the technique is disabled by default.
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::detecting_cards () {
+  if (!opts.card) return false;
+  if (level) return false;
+  if (unsat) return false;
+  if (!cards.empty ()) return false;
+  if (last.card.found) return true;
+  return last.card.irredundant != stats.added.irredundant;
+}
+
+// Check whether two literals occur in a common constraint.  The lists of
+// constraints per literal are short and sorted by construction.
+
+bool Internal::card_connected (int a, int b) {
+  const vector<unsigned> & as = ctab[vlit (a)];
+  const vector<unsigned> & bs = ctab[vlit (b)];
+  auto i = as.begin (), j = bs.begin ();
+  while (i != as.end () && j != bs.end ()) {
+    if (*i < *j) i++;
+    else if (*j < *i) j++;
+    else return true;
+  }
+  return false;
+}
+
+// Binary clauses covered by constraints are removed from the watch lists.
+
+void Internal::unwatch_card_clauses () {
+  for (int idx = 1; idx <= max_var; idx++)
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if (ctab[vlit (lit)].empty ()) continue;
+      Watches & ws = watches (-lit);
+      const const_watch_iterator end = ws.end ();
+      watch_iterator j = ws.begin ();
+      const_watch_iterator i;
+      for (i = j; i != end; i++) {
+        const Watch w = *j++ = *i;
+        if (!w.binary ()) continue;
+        const int other = -w.blit;
+        if (ctab[vlit (other)].empty ()) continue;
+        if (!card_connected (lit, other)) continue;
+        Clause * c = w.clause;
+        if (!c->card) {
+          c->card = true;
+          stats.cardunwatched++;
+        }
+        j--;
+      }
+      ws.resize (j - ws.begin ());
+    }
+}
+
+// Initialize the reason table (including the conflict at index zero).
+
+void Internal::init_card_reasons () {
+  assert (!level);
+  rtab.resize (max_var + 1);
+  for (auto & c : rtab) {
+    memset (&c, 0, sizeof c);
+    c.card = true;
+    c.keep = true;
+    c.glue = 2;
+    c.size = 2;
+    c.pos = 2;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Greedy clique cover of the at-most-one graph.  Starting from literals
+// with many neighbors we extend the clique by those neighbors of the seed
+// which are connected to all literals already in the clique.  Edges of
+// found cliques are removed from the graph, thus a literal can be part of
+// several constraints but each binary clause is only covered once.
+
+void Internal::detect_cards () {
+
+  assert (detecting_cards ());
+  assert (!level);
+  assert (watching ());
+
+  START (card);
+  stats.carddetections++;
+
+  const size_t size = 2 * (max_var + 1);
+  vector<vector<int>> adj (size);
+
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (!active (idx)) continue;
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      vector<int> & neighbors = adj[vlit (lit)];
+      for (const auto & w : watches (-lit)) {
+        if (!w.binary ()) continue;
+        const Clause * c = w.clause;
+        if (c->garbage || c->redundant) continue;
+        const int other = -w.blit;
+        if (!active (other)) continue;
+        neighbors.push_back (other);
+      }
+      sort (neighbors.begin (), neighbors.end ());
+      const auto end = unique (neighbors.begin (), neighbors.end ());
+      neighbors.resize (end - neighbors.begin ());
+    }
+  }
+
+  vector<int> seeds;
+  for (int idx = 1; idx <= max_var; idx++)
+    for (int sign = -1; sign <= 1; sign += 2) {
+      const int lit = sign * idx;
+      if ((int) adj[vlit (lit)].size () + 1 >= opts.cardminsize)
+        seeds.push_back (lit);
+    }
+
+  auto degree = [&] (int lit) { return adj[vlit (lit)].size (); };
+  stable_sort (seeds.begin (), seeds.end (),
+    [&] (int a, int b) { return degree (a) > degree (b); });
+
+  ctab.resize (size);
+  vector<unsigned> count (size);
+  vector<int> clique, candidates;
+
+  int64_t effort = opts.cardmaxeff;
+  int64_t found = 0;
+
+  for (const auto & seed : seeds) {
+
+    while (effort >= 0 && (int) degree (seed) + 1 >= opts.cardminsize) {
+
+      candidates = adj[vlit (seed)];
+      stable_sort (candidates.begin (), candidates.end (),
+        [&] (int a, int b) { return degree (a) > degree (b); });
+
+      clique.clear ();
+      clique.push_back (seed);
+      for (const auto & other : candidates) count[vlit (other)]++;
+      effort -= candidates.size ();
+
+      for (const auto & lit : candidates) {
+        if (count[vlit (lit)] != clique.size ()) continue;
+        clique.push_back (lit);
+        for (const auto & other : adj[vlit (lit)]) count[vlit (other)]++;
+        effort -= degree (lit);
+      }
+
+      for (const auto & lit : clique)
+        for (const auto & other : adj[vlit (lit)])
+          count[vlit (other)] = 0;
+
+      if ((int) clique.size () < opts.cardminsize) break;
+
+      LOG (clique, "found at-most-one constraint of size %zd",
+        clique.size ());
+
+      const unsigned offset = cards.size ();
+      for (const auto & lit : clique) {
+        cards.push_back (lit);
+        ctab[vlit (lit)].push_back (offset);
+        mark (lit);
+      }
+      cards.push_back (0);
+
+      for (const auto & lit : clique) {
+        vector<int> & neighbors = adj[vlit (lit)];
+        auto j = neighbors.begin ();
+        for (const auto & other : neighbors)
+          if (marked (other) <= 0) *j++ = other;
+        neighbors.resize (j - neighbors.begin ());
+      }
+
+      for (const auto & lit : clique) unmark (lit);
+
+      stats.cardlits += clique.size ();
+      found++;
+    }
+  }
+
+  stats.cards += found;
+
+  if (found) {
+    unwatch_card_clauses ();
+    init_card_reasons ();
+  } else erase_vector (ctab);
+
+  last.card.found = found;
+  last.card.irredundant = stats.added.irredundant;
+
+  PHASE ("card", stats.carddetections,
+    "found %" PRId64 " at-most-one constraints with %zd literals",
+    found, cards.size () - (size_t) found);
+
+  STOP (card);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Drop all constraints and watch the covered binary clauses again.  This
+// might happen during search (before 'condition') where covered clauses
+// are still reasons.  Thus the reason table is only released on the root
+// level.
+
+void Internal::reset_cards () {
+  if (!cards.empty ()) {
+    LOG ("resetting %zd at-most-one constraint literals", cards.size ());
+    for (const auto & c : clauses) {
+      if (!c->card) continue;
+      c->card = false;
+      if (!c->garbage) watch_clause (c);
+    }
+    erase_vector (cards);
+    erase_vector (ctab);
+  }
+  if (!level) erase_vector (rtab);
+}
+
+}
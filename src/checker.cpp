@@ -43,6 +43,7 @@ CheckerClause * Checker::new_clause () {
   assert (size > 1), assert (size <= UINT_MAX);
   const size_t bytes = sizeof (CheckerClause) + (size - 2) * sizeof (int);
   CheckerClause * res = (CheckerClause *) new char [bytes];
+  clause_bytes += bytes;
   res->next = 0;
   res->hash = last_hash;
   res->size = size;
@@ -76,6 +77,10 @@ void Checker::delete_clause (CheckerClause * c) {
     assert (c->size > 1);
     assert (num_clauses);
     num_clauses--;
+    const size_t bytes =
+      sizeof (CheckerClause) + (c->size - 2) * sizeof (int);
+    assert (clause_bytes >= bytes);
+    clause_bytes -= bytes;
   } else {
     assert (num_garbage);
     num_garbage--;
@@ -125,6 +130,10 @@ void Checker::collect_garbage_clauses () {
     CheckerClause ** p = clauses + i, * c;
     while ((c = *p)) {
       if (clause_satisfied (c)) {
+        const size_t bytes =
+          sizeof (CheckerClause) + (c->size - 2) * sizeof (int);
+        assert (clause_bytes >= bytes);
+        clause_bytes -= bytes;
         c->size = 0;                    // mark as garbage
         *p = c->next;
         c->next = garbage;
@@ -167,7 +176,7 @@ Checker::Checker (Internal * i)
   internal (i),
   size_vars (0), vals (0),
   inconsistent (false), num_clauses (0), num_garbage (0),
-  size_clauses (0), clauses (0), garbage (0),
+  size_clauses (0), clauses (0), garbage (0), clause_bytes (0),
   next_to_propagate (0), last_hash (0)
 {
   LOG ("CHECKER new");
@@ -199,6 +208,21 @@ Checker::~Checker () {
 
 /*------------------------------------------------------------------------*/
 
+void Checker::memory_usage (Bytes & bytes) const {
+  const size_t vals_bytes = 2*size_vars;
+  bytes.add (vals_bytes, vals_bytes);
+  bytes.add_nested (watchers);
+  bytes.add (marks);
+  bytes.add (unsimplified);
+  bytes.add (simplified);
+  bytes.add (trail);
+  const size_t table_bytes = size_clauses * sizeof (CheckerClause *);
+  bytes.add (table_bytes, table_bytes);
+  bytes.add (clause_bytes, clause_bytes);
+}
+
+/*------------------------------------------------------------------------*/
+
 // The simplicity for accessing 'vals' and 'watchers' directly through a
 // signed integer literal, comes with the price of slightly more complex
 // code in deleting and enlarging the checker data structures.
@@ -426,6 +450,40 @@ bool Checker::check () {
   return res;
 }
 
+// Clauses introducing a fresh variable in bounded variable addition are
+// not implied by unit propagation but are resolution asymmetric
+// tautologies (RAT) on their first literal, the pivot.  These are rare and
+// thus we simply traverse all clauses to find those with the negated pivot
+// and check that all resolvents with them are implied.
+
+bool Checker::check_rat () {
+  assert (!unsimplified.empty ());
+  const int pivot = unsimplified[0];
+  if (val (pivot)) return false;
+  for (uint64_t i = 0; i < size_clauses; i++)
+    for (CheckerClause * c = clauses[i]; c; c = c->next) {
+      const int * literals = c->literals, * end = literals + c->size;
+      if (std::find (literals, end, -pivot) == end) continue;
+      if (clause_satisfied (c)) continue;
+      unsigned previously_propagated = next_to_propagate;
+      bool tautological = false;
+      for (const auto & lit : simplified)
+        assume (-lit);
+      for (const int * p = literals; !tautological && p != end; p++) {
+        const int lit = *p;
+        if (lit == -pivot) continue;
+        const signed char tmp = val (lit);
+        if (tmp > 0) tautological = true;
+        else if (!tmp) assume (-lit);
+      }
+      const bool implied = tautological || !propagate ();
+      backtrack (previously_propagated);
+      if (!implied) return false;
+    }
+  stats.rats++;
+  return true;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Checker::add_clause (const char * type) {
@@ -483,7 +541,7 @@ void Checker::add_derived_clause (const vector<int> & c) {
   import_clause (c);
   if (tautological ())
     LOG ("CHECKER ignoring satisfied derived clause");
-  else if (!check ()) {
+  else if (!check () && !check_rat ()) {
     internal->fatal_message_start ();
     fputs ("failed to check derived clause:\n", stderr);
     for (const auto & lit : unsimplified)
@@ -9,7 +9,7 @@ namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
 
-// This checker implements an online forward DRUP proof checker enabled by
+// This checker implements an online forward DRAT proof checker enabled by
 // 'opts.checkproof' (requires 'opts.check' also to be enabled).  This is
 // useful for model basted testing (and delta-debugging), where we can not
 // rely on an external proof checker such as 'drat-trim'.  We also do not
@@ -19,7 +19,10 @@ namespace CaDiCaL {
 // In essence the checker implements is a simple propagation online SAT
 // solver with an additional hash table to find clauses fast for
 // 'delete_clause'.  It requires its own data structure for clauses
-// ('CheckerClause') and watches ('CheckerWatch').
+// ('CheckerClause') and watches ('CheckerWatch').  Clauses which are not
+// implied by unit propagation are checked to be RAT on their first literal
+// by traversing all clauses, which is only needed for clauses with fresh
+// variables introduced in bounded variable addition.
 //
 // In our experiments the checker slows down overall SAT solving time by a
 // factor of 3, which we contribute to its slightly less efficient
@@ -27,6 +30,8 @@ namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
 
+struct Bytes;
+
 struct CheckerClause {
   CheckerClause * next;         // collision chain link for hash table
   uint64_t hash;                // previously computed full 64-bit hash
@@ -79,6 +84,7 @@ class Checker : public Observer {
   uint64_t size_clauses;        // size of clause hash table
   CheckerClause ** clauses;     // hash table of clauses
   CheckerClause * garbage;      // linked list of garbage clauses
+  uint64_t clause_bytes;        // allocated bytes of clauses
 
   vector<int> unsimplified;     // original clause for reporting
   vector<int> simplified;       // clause for sorting
@@ -122,12 +128,14 @@ class Checker : public Observer {
   bool propagate ();            // propagate and check for conflicts
   void backtrack (unsigned);    // prepare for next clause
   bool check ();                // check simplified clause is implied
+  bool check_rat ();            // check clause is RAT on first literal
 
   struct {
 
     int64_t added;                 // number of added clauses
     int64_t original;              // number of added original clauses
     int64_t derived;               // number of added derived clauses
+    int64_t rats;                  // number of derived RAT clauses
 
     int64_t deleted;               // number of deleted clauses
 
@@ -157,6 +165,8 @@ public:
   void delete_clause (const vector<int> &);
 
   void print_stats ();
+
+  void memory_usage (Bytes &) const;    // Used and reserved bytes.
 };
 
 }
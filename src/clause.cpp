@@ -85,12 +85,14 @@ Clause * Internal::new_clause (bool red, int glue) {
 
   size_t bytes = sizeof (Clause) + (size - 2) * sizeof (int);
   Clause * c = (Clause *) new char[bytes];
+  stats.heapbytes += bytes;
 
   stats.added.total++;
 #ifdef LOGGING
   c->id = stats.added.total;
 #endif
 
+  c->card = false;
   c->conditioned = false;
   c->covered = false;
   c->enqueued = false;
@@ -193,6 +195,11 @@ size_t Internal::shrink_clause (Clause * c, int new_size) {
   size_t new_bytes = c->bytes ();
   size_t res = old_bytes - new_bytes;
 
+  if (!arena.contains (c)) {
+    assert (stats.heapbytes >= (int64_t) res);
+    stats.heapbytes -= res;
+  }
+
   if (c->redundant) promote_clause (c, min (c->size-1, c->glue));
   else if (old_bytes > new_bytes) {
     assert (stats.irrbytes >= (int64_t) res);
@@ -212,6 +219,8 @@ void Internal::deallocate_clause (Clause * c) {
   char * p = (char*) c;
   if (arena.contains (p)) return;
   LOG (c, "deallocate");
+  assert (stats.heapbytes >= (int64_t) c->bytes ());
+  stats.heapbytes -= c->bytes ();
   delete [] p;
 }
 
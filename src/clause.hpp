@@ -27,6 +27,7 @@ struct Clause {
   int64_t id;         // Only useful for debugging.
 #endif
 
+  bool card:1;        // Covered by native at-most-one constraint.
   bool conditioned:1; // Tried for globally blocked clause elimination.
   bool covered:1;     // Already considered for covered clause elimination.
   bool enqueued:1;    // Enqueued on backward queue.
@@ -125,7 +126,8 @@ struct clause_smaller_size {
 // Place literals over the same variable close to each other.  This would
 // allow eager removal of identical literals and detection of tautological
 // clauses but is only currently used for better logging (see also
-// 'opts.logsort' in 'logging.cpp').
+// 'opts.logsort' in 'logging.cpp') and to find duplicated clauses in
+// 'deduplicate_clauses'.
 
 struct clause_lit_less_than {
   bool operator () (int a, int b) const {
@@ -78,10 +78,13 @@ void Internal::mark_satisfied_clauses_as_garbage () {
 // Update occurrence lists before deleting garbage clauses in the context of
 // preprocessing, e.g., during bounded variable elimination 'elim'.  The
 // result is the number of remaining clauses, which in this context means
-// the number of non-garbage clauses.
+// the number of non-garbage clauses.  Within a recycling window (see
+// 'occs.cpp') the lists are not shrunken, since their capacity is reused.
 
 size_t Internal::flush_occs (int lit) {
   Occs & os = occs (lit);
+  Sigs * ss = signing () ? &sigs (lit) : 0;
+  assert (!ss || ss->size () == os.size ());
   const const_occs_iterator end = os.end ();
   occs_iterator j = os.begin ();
   const_occs_iterator i;
@@ -90,12 +93,16 @@ size_t Internal::flush_occs (int lit) {
   for (i = j; i != end; i++) {
     c = *i;
     if (c->collect ()) continue;
+    if (ss) (*ss)[j - os.begin ()] = (*ss)[i - os.begin ()];
     *j++ = c->moved ? c->copy : c;
     assert (!c->redundant);
     res++;
   }
   os.resize (j - os.begin ());
+  if (ss) ss->resize (res);
+  if (occs_recycling) return res;
   shrink_occs (os);
+  if (ss) shrink_vector (*ss);
   return res;
 }
 
@@ -129,16 +136,26 @@ inline void Internal::flush_watches (int lit, Watches & saved) {
   shrink_vector (ws);
 }
 
-void Internal::flush_all_occs_and_watches () {
-  if (occurring ())
-    for (int idx = 1; idx <= max_var; idx++)
-      flush_occs (idx), flush_occs (-idx);
+void Internal::flush_all_occs_and_watches (unsigned workers) {
 
-  if (watching ()) {
-    Watches tmp;
-    for (int idx = 1; idx <= max_var; idx++)
-      flush_watches (idx, tmp), flush_watches (-idx, tmp);
-  }
+  // Lists of different literals are independent and thus can be flushed
+  // in parallel (if 'workers > 1') where each worker handles a consecutive
+  // range of variables.
+
+  if (occurring ())
+    parallel_for (workers, max_var,
+      [&] (unsigned, size_t begin, size_t end) {
+        for (int idx = begin + 1; idx <= (int) end; idx++)
+          flush_occs (idx), flush_occs (-idx);
+      });
+
+  if (watching ())
+    parallel_for (workers, max_var,
+      [&] (unsigned, size_t begin, size_t end) {
+        Watches tmp;
+        for (int idx = begin + 1; idx <= (int) end; idx++)
+          flush_watches (idx, tmp), flush_watches (-idx, tmp);
+      });
 }
 
 /*------------------------------------------------------------------------*/
@@ -174,16 +191,29 @@ void Internal::delete_garbage_clauses () {
 
 /*------------------------------------------------------------------------*/
 
-// This is the start of the copying garbage collector using the arena.  At
-// the core is the following function, which copies a clause to the 'to'
-// space of the arena.  Be careful if this clause is a reason of an
+// This is the start of the copying garbage collector using the arena.  It
+// first determines the order in which clauses are moved by scheduling
+// them, which marks them as 'moved' (even though 'copy' only becomes valid
+// when the clause is actually copied later).  Thus the 'moved' flag has to
+// be reset in the copy.
+//
+inline void Internal::schedule_clause_copy (vector<Clause*> & order,
+                                            Clause * c) {
+  assert (!c->moved);
+  c->moved = true;
+  order.push_back (c);
+}
+
+// At the core is the following function, which copies a clause to the
+// 'to' space of the arena.  Be careful if this clause is a reason of an
 // assignment.  In that case update the reason reference.
 //
 void Internal::copy_clause (Clause * c) {
   LOG (c, "moving");
-  assert (!c->moved);
+  assert (c->moved);
   char * p = (char*) c, * q = arena.copy (p, c->bytes ());
   Clause * d = c->copy = (Clause *) q;
+  d->moved = false;
   LOG ("copied clause[%p] to clause[%p]", c, d);
   if (d->reason) {
     assert (level > 0);
@@ -195,7 +225,57 @@ void Internal::copy_clause (Clause * c) {
       u.reason = d;
     }
   }
-  c->moved = true;
+}
+
+// The parallel version of copying the scheduled clauses into the arena
+// gives exactly the same arena as calling 'copy_clause' on the clauses in
+// the scheduled order.  Each worker first sums up the bytes of its chunk
+// of scheduled clauses.  The prefix sums of these numbers give the
+// destination offset of each chunk in the 'to' space and then all workers
+// copy their chunk to its offset concurrently.  Reason references are
+// updated afterwards by the main thread, since the two watched literals
+// of a reason clause might belong to clauses copied by different workers.
+//
+void Internal::copy_clauses_in_parallel (vector<Clause*> & order,
+                                         unsigned workers) {
+  vector<size_t> offsets (workers + 1, 0);
+
+  parallel_for (workers, order.size (),
+    [&] (unsigned worker, size_t begin, size_t end) {
+      size_t bytes = 0;
+      for (size_t i = begin; i < end; i++)
+        bytes += order[i]->bytes ();
+      offsets[worker + 1] = bytes;
+    });
+
+  for (unsigned worker = 0; worker < workers; worker++)
+    offsets[worker + 1] += offsets[worker];
+
+  char * start = arena.allocate (offsets[workers]);
+
+  parallel_for (workers, order.size (),
+    [&] (unsigned worker, size_t begin, size_t end) {
+      char * q = start + offsets[worker];
+      for (size_t i = begin; i < end; i++) {
+        Clause * c = order[i];
+        const size_t bytes = c->bytes ();
+        memcpy (q, (char *) c, bytes);
+        Clause * d = c->copy = (Clause *) q;
+        d->moved = false;
+        q += bytes;
+      }
+      assert (q == start + offsets[worker + 1]);
+    });
+
+  for (const auto & lit : trail) {
+    Var & v = var (lit);
+    if (!v.level || !v.reason) continue;
+    Clause * c = v.reason;
+    if (!c->reason) continue;
+    if (c->card) continue;      // at-most-one reasons are not moved
+    assert (c->moved);
+    v.reason = c->copy;
+  }
 }
 
 // This is the moving garbage collector.
@@ -221,12 +301,17 @@ void Internal::copy_non_garbage_clauses () {
   //
   arena.prepare (moved_bytes);
 
+  // Schedule clauses in the order they should be placed in the arena.
+  //
+  vector<Clause*> order;
+  order.reserve (moved_clauses);
+
   // Keep clauses in arena in the same order.
   //
   if (opts.arenacompact)
     for (const auto & c : clauses)
       if (!c->collect () && arena.contains (c))
-        copy_clause (c);
+        schedule_clause_copy (order, c);
 
   if (opts.arenatype == 1 || !watching ()) {
 
@@ -245,7 +330,7 @@ void Internal::copy_non_garbage_clauses () {
 
     for (const auto & c : clauses)
       if (!c->moved && !c->collect ())
-        copy_clause (c);
+        schedule_clause_copy (order, c);
 
   } else if (opts.arenatype == 2) {
 
@@ -258,7 +343,7 @@ void Internal::copy_non_garbage_clauses () {
       for (int idx = 1; idx <= max_var; idx++)
         for (const auto & w : watches (sign * likely_phase (idx)))
           if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+            schedule_clause_copy (order, w.clause);
 
   } else {
 
@@ -274,7 +359,7 @@ void Internal::copy_non_garbage_clauses () {
       for (int idx = queue.last; idx; idx = link (idx).prev)
         for (const auto & w : watches (sign * likely_phase (idx)))
           if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+            schedule_clause_copy (order, w.clause);
   }
 
   // Do not forget to move clauses which are not watched, which happened in
@@ -282,11 +367,30 @@ void Internal::copy_non_garbage_clauses () {
   //
   for (const auto & c : clauses)
     if (!c->collect () && !c->moved)
+      schedule_clause_copy (order, c);
+
+  assert (order.size () == moved_clauses);
+
+  // Now actually copy the clauses to the 'to' space, either sequentially
+  // or in parallel, which both give exactly the same result.
+  //
+  const unsigned workers =
+    opts.arenaparallel ? parallel_workers (moved_clauses) : 1;
+
+  if (workers > 1) {
+    stats.parcollections++;
+    PHASE ("collect", stats.collections,
+      "copying clauses with %u workers", workers);
+    copy_clauses_in_parallel (order, workers);
+  } else
+    for (const auto & c : order)
       copy_clause (c);
 
+  erase_vector (order);
+
   // Update watches or occurrence lists.
   //
-  flush_all_occs_and_watches ();
+  flush_all_occs_and_watches (workers);
 
   // Replace and flush clause references in 'clauses'.
   //
@@ -324,7 +428,9 @@ void Internal::copy_non_garbage_clauses () {
 void Internal::check_clause_stats () {
 #ifndef NDEBUG
   int64_t irredundant = 0, redundant = 0, total = 0, irrbytes = 0;
+  int64_t heapbytes = 0;
   for (const auto & c : clauses) {
+    if (!arena.contains (c)) heapbytes += c->bytes ();
     if (c->garbage) continue;
     if (c->redundant) redundant++; else irredundant++;
     if (!c->redundant) irrbytes += c->bytes ();
@@ -334,6 +440,7 @@ void Internal::check_clause_stats () {
   assert (stats.current.redundant == redundant);
   assert (stats.current.total == total);
   assert (stats.irrbytes == irrbytes);
+  assert (stats.heapbytes == heapbytes);
 #endif
 }
 
@@ -349,6 +456,7 @@ void Internal::garbage_collection () {
   report ('G', 1);
   stats.collections++;
   mark_satisfied_clauses_as_garbage ();
+  eager.clear ();
   if (arenaing ()) copy_non_garbage_clauses ();
   else delete_garbage_clauses ();
   check_clause_stats ();
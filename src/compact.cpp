@@ -7,6 +7,15 @@ namespace CaDiCaL {
 // Compacting removes holes generated by inactive variables (fixed,
 // eliminated, substituted or pure) by mapping active variables indices down
 // to a contiguous interval of indices.
+//
+// By default the relative order of variable indices is kept.  If
+// 'opts.compactorder' is non-zero variables are also renumbered such that
+// variables which are used together get close indices and thus their
+// entries in 'vals', 'vtab', 'wtab', 'links' etc. share cache lines.
+// The first variant uses the order of the decision queue (which puts
+// variables bumped in the same conflicts next to each other) and the
+// second a breadth-first traversal of the irredundant clause graph
+// started from variables in queue order.
 
 /*------------------------------------------------------------------------*/
 
@@ -33,6 +42,7 @@ struct Mapper {
   int map_first_fixed;          // Mapped literal of first fixed variable.
   signed char first_fixed_val;  // Value of first fixed variable.
   size_t new_vsize;
+  bool permuted;                // Relative order not kept.
 
   /*----------------------------------------------------------------------*/
   // We produce a compacting garbage collector like map of old 'src' to
@@ -42,23 +52,42 @@ struct Mapper {
   // separately as it is done in Lingeling, where fixed variables are
   // mapped to the internal variable '1'.
   //
-  Mapper (Internal * i) :
+  // If a non-empty 'order' of all active variables is given, then active
+  // variables are mapped in that order instead and the first fixed
+  // variable is mapped last.
+  //
+  Mapper (Internal * i, const vector<int> & order) :
     internal (i),
     new_max_var (0),
     first_fixed (0),
     map_first_fixed (0),
-    first_fixed_val (0)
+    first_fixed_val (0),
+    permuted (!order.empty ())
   {
     table = new int [ internal->max_var + 1 ];
     clear_n (table, internal->max_var + 1);
 
     assert (!internal->level);
 
-    for (int src = 1; src <= internal->max_var; src++) {
-      const Flags & f = internal->flags (src);
-      if (f.active ()) table[src] = ++new_max_var;
-      else if (f.fixed () && !first_fixed)
-        table[first_fixed = src] = map_first_fixed = ++new_max_var;
+    if (permuted) {
+      for (const auto & src : order) {
+        assert (internal->flags (src).active ());
+        assert (!table[src]);
+        table[src] = ++new_max_var;
+      }
+      for (int src = 1; src <= internal->max_var; src++) {
+        const Flags & f = internal->flags (src);
+        assert (!f.active () || table[src]);
+        if (f.fixed () && !first_fixed)
+          table[first_fixed = src] = map_first_fixed = ++new_max_var;
+      }
+    } else {
+      for (int src = 1; src <= internal->max_var; src++) {
+        const Flags & f = internal->flags (src);
+        if (f.active ()) table[src] = ++new_max_var;
+        else if (f.fixed () && !first_fixed)
+          table[first_fixed = src] = map_first_fixed = ++new_max_var;
+      }
     }
 
     first_fixed_val = first_fixed ? internal->val (first_fixed) : 0;
@@ -97,11 +126,24 @@ struct Mapper {
   }
 
   /*----------------------------------------------------------------------*/
-  // Map positive variable indices in vector.
+  // Map positive variable indices in vector.  If the relative order of
+  // variables is kept, this can be done in place, otherwise we need to
+  // move entries to a new vector.
   //
   template<class T>
   void map_vector (vector<T> & v) {
     const int max_var = internal->max_var;
+    if (permuted) {
+      vector<T> mapped (new_vsize);
+      mapped[0] = move (v[0]);
+      for (int src = 1; src <= max_var; src++) {
+        const int dst = map_idx (src);
+        if (!dst) continue;
+        mapped[dst] = move (v[src]);
+      }
+      v.swap (mapped);
+      return;
+    }
     for (int src = 1; src <= max_var; src++) {
       const int dst = map_idx (src);
       if (!dst) continue;
@@ -119,6 +161,19 @@ struct Mapper {
   template<class T>
   void map2_vector (vector<T> & v) {
     const int max_var = internal->max_var;
+    if (permuted) {
+      vector<T> mapped (2*new_vsize);
+      mapped[0] = move (v[0]);
+      mapped[1] = move (v[1]);
+      for (int src = 1; src <= max_var; src++) {
+        const int dst = map_idx (src);
+        if (!dst) continue;
+        mapped[2*dst] = move (v[2*src]);
+        mapped[2*dst + 1] = move (v[2*src + 1]);
+      }
+      v.swap (mapped);
+      return;
+    }
     for (int src = 1; src <= max_var; src++) {
       const int dst = map_idx (src);
       if (!dst) continue;
@@ -141,7 +196,7 @@ struct Mapper {
     for (; i != end; i++) {
       const int src = *i;
       int dst = map_idx (abs (src));
-      assert (abs (dst) <= abs (src));
+      assert (permuted || abs (dst) <= abs (src));
       if (!dst) continue;
       if (src < 0) dst = -dst;
       *j++ = dst;
@@ -154,12 +209,76 @@ struct Mapper {
 
 /*------------------------------------------------------------------------*/
 
+// Order active variables as they occur in the decision queue.
+
+void Internal::compact_queue_order (vector<int> & order) {
+  for (int idx = queue.first; idx; idx = link (idx).next)
+    if (active (idx)) order.push_back (idx);
+}
+
+// Breadth-first search over irredundant clauses, where 'order' is also
+// used as search queue.  Traversal is started from variables in the order
+// of the decision queue, which also catches all variables not occurring in
+// any irredundant clause.  Each clause is only traversed once.
+
+void Internal::compact_bfs_order (vector<int> & order) {
+
+  // Occurrences of active variables in irredundant clauses as compressed
+  // rows of clause indices, i.e., 'occs[start[idx]..start[idx+1]-1]'.
+  //
+  vector<size_t> start (max_var + 2, 0);
+  for (const auto & c : clauses) {
+    if (c->redundant) continue;
+    for (const auto & lit : *c)
+      if (active (lit)) start[vidx (lit) + 1]++;
+  }
+  for (int idx = 1; idx <= max_var + 1; idx++)
+    start[idx] += start[idx - 1];
+  vector<unsigned> occs (start[max_var + 1]);
+  {
+    vector<size_t> pos (start.begin (), start.end () - 1);
+    for (size_t i = 0; i < clauses.size (); i++) {
+      const Clause * c = clauses[i];
+      if (c->redundant) continue;
+      for (const auto & lit : *c)
+        if (active (lit)) occs[pos[vidx (lit)]++] = i;
+    }
+  }
+
+  vector<bool> ordered (max_var + 1, false);
+  vector<bool> traversed (clauses.size (), false);
+
+  for (int root = queue.first; root; root = link (root).next) {
+    if (!active (root) || ordered[root]) continue;
+    ordered[root] = true;
+    size_t head = order.size ();
+    order.push_back (root);
+    while (head < order.size ()) {
+      const int idx = order[head++];
+      for (size_t k = start[idx]; k < start[idx + 1]; k++) {
+        const unsigned i = occs[k];
+        if (traversed[i]) continue;
+        traversed[i] = true;
+        for (const auto & lit : *clauses[i]) {
+          const int other = vidx (lit);
+          if (!active (other) || ordered[other]) continue;
+          ordered[other] = true;
+          order.push_back (other);
+        }
+      }
+    }
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 static signed char * ignore_clang_analyze_memory_leak_warning;
 
 void Internal::compact () {
 
   START (compact);
 
+  reset_cards ();
   assert (active () < max_var);
 
   stats.compacts++;
@@ -176,7 +295,19 @@ void Internal::compact () {
 
   garbage_collection ();
 
-  Mapper mapper (this);
+  vector<int> order;
+  if (opts.compactorder == 1) compact_queue_order (order);
+  else if (opts.compactorder == 2) compact_bfs_order (order);
+  if (!order.empty ()) {
+    assert (order.size () == (size_t) active ());
+    stats.renumbered++;
+    PHASE ("compact", stats.compacts,
+      "renumbering %zd active variables in %s order", order.size (),
+      opts.compactorder == 1 ? "queue" : "breadth-first search");
+  }
+
+  Mapper mapper (this, order);
+  erase_vector (order);
 
   if (mapper.first_fixed)
     LOG ("found first fixed %d",
@@ -195,13 +326,13 @@ void Internal::compact () {
 
   // Flush the external indices.  This has to occur before we map 'vals'.
   //
-  for (int eidx = 1; eidx <= external->max_var; eidx++) {
+  for (const auto & eidx : external->evars) {
     int src = external->e2i[eidx], dst;
     if (!src) continue;
     dst = mapper.map_lit (src);
     LOG ("compact %" PRId64 " maps external %d to internal %d from internal %d",
       stats.compacts, eidx, dst, src);
-    external->e2i[eidx] = dst;
+    external->e2i.set (eidx, dst);
   }
 
   // Map the literals in all clauses.
@@ -275,16 +406,19 @@ void Internal::compact () {
 
   // Special code for 'frozentab'.
   //
-  for (int src = 1; src <= max_var; src++) {
-    const int dst = mapper.map_idx (src);
-    if (!dst) continue;
-    if (src == dst) continue;
-    assert (dst < src);
-    frozentab[dst] += frozentab[src];
-    frozentab[src] = 0;
+  if (mapper.permuted) mapper.map_vector (frozentab);
+  else {
+    for (int src = 1; src <= max_var; src++) {
+      const int dst = mapper.map_idx (src);
+      if (!dst) continue;
+      if (src == dst) continue;
+      assert (dst < src);
+      frozentab[dst] += frozentab[src];
+      frozentab[src] = 0;
+    }
+    frozentab.resize (mapper.new_vsize);
+    shrink_vector (frozentab);
   }
-  frozentab.resize (mapper.new_vsize);
-  shrink_vector (frozentab);
 
   /*----------------------------------------------------------------------*/
 
@@ -309,7 +443,9 @@ void Internal::compact () {
   // Special case for 'val' as for 'val' we trade branch less code for
   // memory and always allocated an [-maxvar,...,maxvar] array.
   {
-    signed char * new_vals = new signed char [ 2*mapper.new_vsize ];
+    size_t new_vals_mapped;
+    signed char * new_vals = (signed char *)
+      new_pages (2*mapper.new_vsize, new_vals_mapped);
     ignore_clang_analyze_memory_leak_warning = new_vals;
     new_vals += mapper.new_vsize;
     for (int src = -max_var; src <= -1; src++)
@@ -317,9 +453,9 @@ void Internal::compact () {
     for (int src = 1; src <= max_var; src++)
       new_vals[mapper.map_idx (src)] = vals[src];
     new_vals[0] = 0;
-    vals -= vsize;
-    delete [] vals;
+    delete_vals ();
     vals = new_vals;
+    vals_mapped = new_vals_mapped;
   }
 
   mapper.map_vector (i2e);
@@ -849,6 +849,8 @@ void Internal::condition (bool update_limits) {
   if (unsat) return;
   if (!stats.current.irredundant) return;
 
+  reset_cards ();
+
   START_SIMPLIFIER (condition, CONDITION);
   stats.conditionings++;
 
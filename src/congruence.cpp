@@ -0,0 +1,371 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Congruence closure on gates.  All AND gates, binary XOR gates and
+// if-then-else gates are extracted from the irredundant clauses up front
+// (the gate finders in 'gates.cpp' only look at gates of the pivot during
+// elimination).  Two gates of the same type with the same inputs have
+// equivalent outputs.  After merging these outputs the inputs of all gates
+// are replaced by the representatives of their equivalence classes, which
+// in turn might make further gates identical.  This is repeated until
+// fix-point and then the equivalences are added as binary clauses, which
+// are substituted by 'decompose'.
+//
+// Gates are normalized to make structurally identical gates syntactically
+// identical.  The inputs of AND gates are sorted, the inputs of XOR gates
+// are positive and sorted (negations are moved to the output), and for
+// if-then-else gates the condition and the then-branch are positive.
+//
+// The equivalence 'a = b' of the outputs of two congruent gates is RUP
+// given the clauses of both gates and previously added equivalences,
+// except for XOR and if-then-else gates, where we have to split on the
+// first input.  In this case we temporarily add the two clauses
+// '-a | b | v' and '-a | b | -v' to the proof, where 'v' is the first
+// input, and then derive '-a | b' (similarly for '-b | a').
+
+/*------------------------------------------------------------------------*/
+
+struct CGate {
+  int lhs;              // output literal
+  int type;             // 'AND', 'XOR' or 'ITE'
+  bool garbage;         // degenerated after substitution
+  vector<int> rhs;      // normalized inputs
+};
+
+enum { CGATE_AND = 0, CGATE_XOR = 1, CGATE_ITE = 2 };
+
+struct Closure {
+
+  Internal * internal;
+
+  vector<CGate> gates;
+  vector<int> reprs;    // representative literal per variable
+
+  Closure (Internal * i) : internal (i) {
+    reprs.resize (internal->max_var + 1);
+    for (int idx = 0; idx <= internal->max_var; idx++) reprs[idx] = idx;
+  }
+
+  int find (int lit) {
+    const int idx = abs (lit);
+    int res = reprs[idx];
+    if (res != idx) reprs[idx] = res = find (res);
+    return lit < 0 ? -res : res;
+  }
+
+  void add (int lhs, int type, const vector<int> & rhs) {
+    CGate g;
+    g.lhs = lhs;
+    g.type = type;
+    g.garbage = false;
+    g.rhs = rhs;
+    gates.push_back (g);
+  }
+};
+
+struct cgate_less_than {
+  const vector<CGate> & gates;
+  cgate_less_than (const vector<CGate> & g) : gates (g) { }
+  bool operator () (unsigned a, unsigned b) const {
+    const CGate & g = gates[a], & h = gates[b];
+    if (g.type != h.type) return g.type < h.type;
+    return g.rhs < h.rhs;
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+// Find an irredundant ternary clause with exactly the given literals.
+
+bool Internal::congruence_find_ternary (int a, int b, int c) {
+  int lit = a;
+  if (occs (b).size () < occs (lit).size ()) lit = b;
+  if (occs (c).size () < occs (lit).size ()) lit = c;
+  for (const auto & d : occs (lit)) {
+    if (d->size != 3) continue;
+    int found = 0;
+    for (const auto & other : *d)
+      if (other == a || other == b || other == c) found++;
+    if (found == 3) return true;
+  }
+  return false;
+}
+
+// Extract AND gates 'lhs = r_1 & ... & r_k' from a base clause
+// 'lhs | -r_1 | ... | -r_k' and the binary clauses '-lhs | r_i'.
+
+void Internal::congruence_extract_ands (Closure & closure, Clause * c,
+                                        int64_t & ticks) {
+  if (c->size > opts.congruencearity + 1) return;
+  vector<int> rhs;
+  for (const auto & lhs : *c) {
+    const Occs & os = occs (-lhs);
+    if (os.size () < (size_t) c->size - 1) continue;
+    ticks += os.size ();
+    for (const auto & d : os) {
+      if (d->size != 2) continue;
+      const int other = d->literals[0] ^ d->literals[1] ^ -lhs;
+      if (!marked (other)) mark (other);        // Duplicated binaries.
+    }
+    bool gate = true;
+    for (const auto & other : *c)
+      if (other != lhs && marked (-other) <= 0) { gate = false; break; }
+    for (const auto & d : os)
+      if (d->size == 2) unmark (d->literals[0] ^ d->literals[1] ^ -lhs);
+    if (!gate) continue;
+    rhs.clear ();
+    for (const auto & other : *c)
+      if (other != lhs) rhs.push_back (-other);
+    LOG (rhs, "found AND gate %d with inputs", lhs);
+    closure.add (lhs, CGATE_AND, rhs);
+    stats.congruenceands++;
+  }
+}
+
+// Extract XOR gates from the four ternary clauses 'a | b | c',
+// 'a | -b | -c', '-a | b | -c' and '-a | -b | c', which encode
+// 'a ^ b ^ c = 1'.  Each of the three literals is an output.
+
+void Internal::congruence_extract_xors (Closure & closure, Clause * c,
+                                        int64_t & ticks) {
+  if (c->size != 3) return;
+  const int * lits = c->literals;
+  const int a = lits[0], b = lits[1], d = lits[2];
+  ticks += 3;
+  if (!congruence_find_ternary (a, -b, -d)) return;
+  if (!congruence_find_ternary (-a, b, -d)) return;
+  if (!congruence_find_ternary (-a, -b, d)) return;
+  LOG ("found XOR gate over %d %d %d", a, b, d);
+  closure.add (-a, CGATE_XOR, { b, d });
+  closure.add (-b, CGATE_XOR, { a, d });
+  closure.add (-d, CGATE_XOR, { a, b });
+  stats.congruencexors++;
+}
+
+// Extract if-then-else gates 'lhs = cond ? then : else' encoded by the
+// clauses '-lhs | -cond | then', 'lhs | -cond | -then', '-lhs | cond |
+// else' and 'lhs | cond | -else'.  The given clause is the first one.
+
+void Internal::congruence_extract_ites (Closure & closure, Clause * c,
+                                        int64_t & ticks) {
+  if (c->size != 3) return;
+  const int * lits = c->literals;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) {
+      if (i == j) continue;
+      const int lhs = -lits[i], cond = -lits[j], then = lits[3 - i - j];
+      if (!congruence_find_ternary (lhs, -cond, -then)) continue;
+      for (const auto & d : occs (-lhs)) {
+        ticks++;
+        if (d->garbage || d->size != 3) continue;
+        int other = 0, found = 0;
+        for (const auto & tmp : *d)
+          if (tmp == -lhs || tmp == cond) found++;
+          else other = tmp;
+        if (found != 2 || !other) continue;
+        if (other == then || other == -then) continue;
+        if (!congruence_find_ternary (lhs, cond, -other)) continue;
+        LOG ("found ITE gate %d = %d ? %d : %d", lhs, cond, then, other);
+        closure.add (lhs, CGATE_ITE, { cond, then, other });
+        stats.congruenceites++;
+      }
+    }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Replace inputs by their representatives and normalize the gate.  Returns
+// 'false' if the gate degenerated (and should be ignored from now on).
+
+bool Internal::congruence_normalize (Closure & closure, CGate & g) {
+  vector<int> & rhs = g.rhs;
+  for (auto & lit : rhs) lit = closure.find (lit);
+  if (g.type == CGATE_AND) {
+    sort (rhs.begin (), rhs.end (), [] (int a, int b) {
+      return abs (a) < abs (b) || (abs (a) == abs (b) && a < b);
+    });
+    const auto end = unique (rhs.begin (), rhs.end ());
+    rhs.resize (end - rhs.begin ());
+    for (size_t i = 1; i < rhs.size (); i++)
+      if (rhs[i - 1] == -rhs[i]) return false;
+    if (rhs.size () < 2) return false;
+  } else if (g.type == CGATE_XOR) {
+    for (auto & lit : rhs)
+      if (lit < 0) lit = -lit, g.lhs = -g.lhs;
+    sort (rhs.begin (), rhs.end ());
+    if (rhs[0] == rhs[1]) return false;
+  } else {
+    assert (g.type == CGATE_ITE);
+    int & cond = rhs[0], & then = rhs[1], & other = rhs[2];
+    if (cond < 0) cond = -cond, swap (then, other);
+    if (then < 0) then = -then, other = -other, g.lhs = -g.lhs;
+    if (abs (then) == cond || abs (other) == cond) return false;
+    if (then == other) return false;
+  }
+  const int lhs = closure.find (g.lhs);
+  for (const auto & lit : rhs)
+    if (abs (lit) == abs (lhs)) return false;
+  return true;
+}
+
+// Add the equivalence 'a = b' of the outputs of two congruent gates.  If
+// the outputs are complementary ('a = -b') or 'a = -b' follows from
+// previously added equivalences, the formula is unsatisfiable.  Then we
+// derive the units '-a' and 'a' (respectively '-a' and the empty clause
+// through the added binary clauses), learn the empty clause and return
+// 'false' to stop merging.
+
+bool Internal::congruence_merge (Closure & closure, const CGate & g,
+                                 int a, int b) {
+  const int ra = closure.find (a), rb = closure.find (b);
+  assert (ra != rb);
+  const bool split = proof && g.type != CGATE_AND;
+  const int v = g.rhs[0];
+  if (a == -b) {
+    LOG ("congruent gates with complementary outputs %d and %d", a, b);
+    for (int sign = -1; !unsat && sign <= 1; sign += 2) {
+      const int x = sign * a;
+      vector<int> first { -x, v }, second { -x, -v };
+      if (split) {
+        proof->add_derived_clause (first);
+        proof->add_derived_clause (second);
+      }
+      const signed char tmp = val (-x);
+      if (tmp < 0) learn_empty_clause ();
+      else if (!tmp) assign_unit (-x);
+      if (split && !unsat) {
+        proof->delete_clause (first);
+        proof->delete_clause (second);
+      }
+    }
+    stats.congruenceclashes++;
+    return false;
+  }
+  LOG ("congruent gates give equivalence %d = %d", a, b);
+  for (int sign = -1; sign <= 1; sign += 2) {
+    const int x = sign * a, y = sign * b;
+    vector<int> first { -x, y, v }, second { -x, y, -v };
+    if (split) {
+      proof->add_derived_clause (first);
+      proof->add_derived_clause (second);
+    }
+    assert (clause.empty ());
+    clause.push_back (-x);
+    clause.push_back (y);
+    new_hyper_binary_resolved_clause (true, 2);
+    clause.clear ();
+    if (split) {
+      proof->delete_clause (first);
+      proof->delete_clause (second);
+    }
+  }
+  stats.congruencemerged++;
+  if (ra == -rb) {
+    LOG ("equivalence %d = %d contradicts previous equivalences", a, b);
+    const signed char tmp = val (-a);
+    if (!tmp) assign_unit (-a);
+    learn_empty_clause ();
+    stats.congruenceclashes++;
+    return false;
+  }
+  if (abs (ra) < abs (rb)) closure.reprs[abs (rb)] = rb < 0 ? -ra : ra;
+  else closure.reprs[abs (ra)] = ra < 0 ? -rb : rb;
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::congruence () {
+
+  if (!opts.congruence) return false;
+  if (unsat || terminating ()) return false;
+
+  // No new irredundant clauses added since last time?
+  //
+  if (last.congruence.irredundant == stats.added.irredundant) return false;
+
+  assert (!level);
+  assert (watching ());
+
+  if (!propagate ()) { learn_empty_clause (); return false; }
+
+  START_SIMPLIFIER (congruence, CONGRUENCE);
+  stats.congruence++;
+
+  init_occs ();
+  for (const auto & c : clauses) {
+    if (c->garbage || c->redundant) continue;
+    bool assigned = false;
+    for (const auto & lit : *c)
+      if (val (lit)) { assigned = true; break; }
+    if (assigned) continue;
+    for (const auto & lit : *c)
+      occs (lit).push_back (c);
+  }
+
+  Closure closure (this);
+  int64_t ticks = 0;
+
+  for (const auto & c : clauses) {
+    if (ticks > opts.congruencemaxeff) break;
+    if (c->garbage || c->redundant || c->size < 3) continue;
+    bool assigned = false;
+    for (const auto & lit : *c)
+      if (val (lit)) { assigned = true; break; }
+    if (assigned) continue;
+    congruence_extract_ands (closure, c, ticks);
+    congruence_extract_xors (closure, c, ticks);
+    congruence_extract_ites (closure, c, ticks);
+  }
+
+  reset_occs ();
+
+  PHASE ("congruence", stats.congruence,
+    "extracted %zd gates", closure.gates.size ());
+
+  const int64_t old_merged = stats.congruencemerged;
+
+  // Merge outputs of identical gates until fix-point.
+  //
+  vector<unsigned> schedule;
+  bool merged = true, inconsistent = false;
+  while (merged && !inconsistent && !terminating ()) {
+    merged = false;
+    schedule.clear ();
+    for (unsigned i = 0; i < closure.gates.size (); i++) {
+      CGate & g = closure.gates[i];
+      if (g.garbage) continue;
+      if (!congruence_normalize (closure, g)) g.garbage = true;
+      else schedule.push_back (i);
+    }
+    stable_sort (schedule.begin (), schedule.end (),
+      cgate_less_than (closure.gates));
+    for (size_t i = 1; i < schedule.size (); i++) {
+      const CGate & g = closure.gates[schedule[i - 1]];
+      const CGate & h = closure.gates[schedule[i]];
+      if (g.type != h.type || g.rhs != h.rhs) continue;
+      if (closure.find (g.lhs) == closure.find (h.lhs)) continue;
+      merged = true;
+      if (congruence_merge (closure, g, g.lhs, h.lhs)) continue;
+      inconsistent = true;
+      break;
+    }
+  }
+
+  const int64_t equivalences = stats.congruencemerged - old_merged;
+
+  PHASE ("congruence", stats.congruence,
+    "found %" PRId64 " equivalences", equivalences);
+
+  last.congruence.irredundant = stats.added.irredundant;
+
+  STOP_SIMPLIFIER (congruence, CONGRUENCE);
+  report ('k', !opts.reportall && !equivalences);
+
+  return equivalences > 0;
+}
+
+}
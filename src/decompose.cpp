@@ -43,6 +43,13 @@ bool Internal::decompose_round () {
 #endif
   unsigned dfs_idx = 0;
 
+  // Depth first search only reads binary clauses and visits each literal
+  // twice, thus it is cheaper to traverse a CSR snapshot of the binary
+  // implication graph than the (unsorted) watches.
+  //
+  BinGraph graph;
+  init_bin_graph (graph);
+
   vector<int> work;                     // depth first search working stack
   vector<int> scc;                      // collects members of one SCC
 
@@ -67,10 +74,11 @@ bool Internal::decompose_round () {
         } else {
           assert (!reprs [vlit (parent)]);
 
-          // Go over all implied literals, thus need to iterate over all
-          // binary watched clauses with the negation of 'parent'.
+          // Go over all implied literals, i.e., all edges of 'parent' in
+          // the binary implication graph.
 
-          Watches & ws = watches (-parent);
+          const Bin * const bob = graph.begin (vlit (parent));
+          const Bin * const eob = graph.end (vlit (parent));
 
           // Two cases: Either the node has never been visited before, i.e.,
           // it's depth first search index is zero, then perform the
@@ -88,9 +96,8 @@ bool Internal::decompose_round () {
 
             unsigned new_min = parent_dfs.min;
 
-            for (const auto & w : ws) {
-              if (!w.binary ()) continue;
-              const int child = w.blit;
+            for (const Bin * k = bob; k != eob; k++) {
+              const int child = k->lit;
               if (!active (child)) continue;
               const DFS & child_dfs = dfs[vlit (child)];
               if (new_min > child_dfs.min) new_min = child_dfs.min;
@@ -167,9 +174,8 @@ bool Internal::decompose_round () {
             // Now traverse all the children in the binary implication
             // graph but keep 'parent' on the stack for 'post-fix' work.
 
-            for (const auto & w : ws) {
-              if (!w.binary ()) continue;
-              const int child = w.blit;
+            for (const Bin * k = bob; k != eob; k++) {
+              const int child = k->lit;
               if (!active (child)) continue;
               const DFS & child_dfs = dfs[vlit (child)];
               if (child_dfs.idx) continue;
@@ -183,6 +189,7 @@ bool Internal::decompose_round () {
 
   erase_vector (work);
   erase_vector (scc);
+  graph.erase ();
   delete [] dfs;
 
   // Only keep the representatives 'repr' mapping.
@@ -134,4 +134,153 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
   report ('2', !opts.reportall && !(subsumed + units));
 }
 
+/*------------------------------------------------------------------------*/
+
+// Bounded variable elimination often produces the same resolvent several
+// times and some instances contain duplicated clauses too.  Duplicated
+// clauses of all sizes are found here by hashing.  The literals of each
+// clause are sorted in place by variable index and the hash of the sorted
+// variables is computed as in 'gauss'.  Clauses with the same size and
+// hash are compared literal by literal.  If all literals are identical the
+// clause is removed, keeping an irredundant copy.  If the two clauses only
+// differ in the sign of one literal, i.e., they are of the form '(A, l)'
+// and '(A, -l)', then their resolvent 'A' subsumes both.  One of them (the
+// irredundant one if any) is strengthened to 'A' and the other removed.
+// For two binary clauses the resolvent is a unit.  Clauses with root level
+// assigned literals are skipped.  Since literals are removed in place this
+// requires that watches are disconnected (it is called from 'elim').
+
+struct DedupCandidate {
+  uint64_t hash;        // hash value of sorted variables
+  Clause * clause;
+};
+
+struct dedup_candidate_less_than {
+  bool operator () (const DedupCandidate & a,
+                    const DedupCandidate & b) const {
+    if (a.clause->size < b.clause->size) return true;
+    if (a.clause->size > b.clause->size) return false;
+    return a.hash < b.hash;
+  }
+};
+
+// Returns the number of literals with different sign if 'c' and 'd' have
+// the same variables (in the same order) and 'INT_MAX' otherwise.
+
+static int dedup_differences (const Clause * c, const Clause * d) {
+  assert (c->size == d->size);
+  int res = 0;
+  for (int i = 0; i < c->size; i++) {
+    const int a = c->literals[i], b = d->literals[i];
+    if (a == b) continue;
+    if (a != -b) return INT_MAX;
+    res++;
+  }
+  return res;
+}
+
+void Internal::deduplicate_clauses () {
+
+  if (!opts.deduplicateall) return;
+  if (unsat || terminating ()) return;
+
+  assert (!level);
+  assert (!watching ());
+
+  START_SIMPLIFIER (deduplicate, DEDUP);
+  stats.dedups++;
+
+  vector<DedupCandidate> candidates;
+  for (const auto & c : clauses) {
+    if (c->garbage) continue;
+    bool assigned = false;
+    for (const auto & lit : *c)
+      if (val (lit)) { assigned = true; break; }
+    if (assigned) continue;
+    sort (c->begin (), c->end (), clause_lit_less_than ());
+    DedupCandidate candidate;
+    candidate.hash = 0;
+    candidate.clause = c;
+    for (const auto & lit : *c)
+      candidate.hash = (candidate.hash + abs (lit)) * 0x9e3779b97f4a7c15ull;
+    candidates.push_back (candidate);
+  }
+
+  stable_sort (candidates.begin (), candidates.end (),
+               dedup_candidate_less_than ());
+
+  int64_t duplicated = 0, strengthened = 0, units = 0;
+
+  const auto begin = candidates.begin ();
+  const auto end = candidates.end ();
+
+  for (auto i = begin, j = begin; !unsat && i != end; i = j) {
+
+    const int size = i->clause->size;
+    for (j = i + 1; j != end; j++)
+      if (j->clause->size != size || j->hash != i->hash) break;
+
+    for (auto k = i; !unsat && k != j; k++) {
+      Clause * c = k->clause;
+      if (c->garbage) continue;
+      for (auto l = k + 1; l != j; l++) {
+        Clause * d = l->clause;
+        if (d->garbage) continue;
+        if (c->size != d->size) continue;     // 'c' strengthened
+        const int differences = dedup_differences (c, d);
+        if (differences > 1) continue;
+        Clause * keep = c, * remove = d;
+        if (c->redundant && !d->redundant) swap (keep, remove);
+        if (!differences) {
+          LOG (remove, "found duplicated");
+          stats.subsumed++;
+          stats.deduplicated++;
+          duplicated++;
+          mark_garbage (remove);
+          if (remove == c) break;
+          continue;
+        }
+        int pivot = 0;
+        for (int m = 0; m < size; m++)
+          if (keep->literals[m] != remove->literals[m])
+            pivot = keep->literals[m];
+        assert (pivot);
+        if (size == 2) {
+          const int unit = keep->literals[0] ^ keep->literals[1] ^ pivot;
+          LOG ("found %d %d and %d %d which produces unit %d",
+            unit, pivot, unit, -pivot, unit);
+          const signed char tmp = val (unit);
+          if (tmp < 0) learn_empty_clause ();
+          else if (!tmp) {
+            stats.failed++;
+            stats.hyperunary++;
+            units++;
+            assign_unit (unit);
+          }
+          break;
+        }
+        LOG (keep, "self-subsuming resolution on %d with", pivot);
+        LOG (remove, "self-subsuming resolution on %d with", -pivot);
+        stats.dedupstrs++;
+        strengthened++;
+        strengthen_clause (keep, pivot);
+        stats.subsumed++;
+        mark_garbage (remove);
+        break;
+      }
+    }
+  }
+
+  erase_vector (candidates);
+
+  PHASE ("deduplicate", stats.dedups,
+    "removed %" PRId64 " duplicated clauses, strengthened %" PRId64
+    " clauses and found %" PRId64 " units",
+    duplicated, strengthened, units);
+
+  STOP_SIMPLIFIER (deduplicate, DEDUP);
+
+  report ('D', !opts.reportall && !(duplicated + strengthened + units));
+}
+
 }
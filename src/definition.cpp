@@ -0,0 +1,262 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Semantic gate extraction, also called definition mining.  The syntactic
+// gate patterns in 'gates.cpp' miss gates which are encoded in
+// non-standard ways, e.g., with additional redundant clauses or with
+// clauses shared between gates.  Instead the clauses in which the pivot
+// occurs are checked semantically.  After removing the pivot these clauses
+// are unsatisfiable iff the pivot is defined by the other variables, i.e.,
+// the clauses with the pivot encode a function (or the pivot is implied).
+// An unsatisfiable core of these clauses is then used as gate clauses.
+//
+// As for syntactic gates resolvents between two non-gate clauses are
+// redundant and are skipped.  However, in contrast to syntactic gates,
+// resolvents between two gate clauses are not tautological in general and
+// still have to be generated.  Otherwise the extension stack, which only
+// contains gate clauses, would not be able to reconstruct a model.
+//
+// Satisfiability is checked by a tiny DPLL solver over the few clauses,
+// which is good enough for the small number of occurrences we consider.
+// Propagation uses occurrence lists and counts false and true literals per
+// clause.  The core is obtained by removing one clause after the other and
+// keeping those which are needed for unsatisfiability.  All solver calls
+// for one pivot share an effort limit in terms of visited occurrences.  If
+// it is hit, the remaining clauses are simply kept in the core.
+
+struct Definer {
+
+  struct Decision {
+    unsigned lit;
+    size_t trail;
+    bool flipped;
+  };
+
+  vector<unsigned> lits;                // literals '2*idx + sign'
+  vector<unsigned> starts;              // clause 'i' starts at 'starts[i]'
+  vector<bool> active;                  // clause part of the core
+  vector<unsigned> falsified;           // false literals per clause
+  vector<unsigned> satisfied;           // true literals per clause
+  vector<unsigned> offsets;             // occurrences of literal 'l'
+  vector<unsigned> occs;                // start at 'offsets[l]'
+  vector<signed char> vals;             // by literal
+  vector<unsigned> trail;
+  vector<Decision> control;
+  size_t propagated;
+  int64_t ticks, limit;
+
+  Definer (int64_t l) : propagated (0), ticks (0), limit (l) { }
+
+  unsigned clauses () const { return starts.size () - 1; }
+  unsigned size (unsigned c) const { return starts[c+1] - starts[c]; }
+
+  void init (unsigned num_lits);
+  void assign (unsigned lit);
+  void backtrack (size_t size);
+  bool propagate ();
+  unsigned decide ();
+  int solve ();
+};
+
+// Connect the literals in 'lits' to occurrence lists (in CSR format).
+
+void Definer::init (unsigned num_lits) {
+  offsets.assign (num_lits + 1, 0);
+  for (const auto & lit : lits)
+    offsets[lit]++;
+  unsigned sum = 0;
+  for (auto & offset : offsets)
+    offset = (sum += offset);
+  occs.resize (sum);
+  for (unsigned c = clauses (); c--; )
+    for (unsigned i = starts[c]; i < starts[c+1]; i++)
+      occs[--offsets[lits[i]]] = c;
+  falsified.assign (clauses (), 0);
+  satisfied.assign (clauses (), 0);
+  active.assign (clauses (), true);
+  vals.assign (num_lits, 0);
+}
+
+void Definer::assign (unsigned lit) {
+  assert (!vals[lit]);
+  vals[lit] = 1;
+  vals[lit ^ 1] = -1;
+  trail.push_back (lit);
+  for (unsigned i = offsets[lit]; i < offsets[lit+1]; i++)
+    satisfied[occs[i]]++;
+  for (unsigned i = offsets[lit^1]; i < offsets[(lit^1)+1]; i++)
+    falsified[occs[i]]++;
+  ticks += offsets[lit+1] - offsets[lit];
+  ticks += offsets[(lit^1)+1] - offsets[lit^1];
+}
+
+void Definer::backtrack (size_t size) {
+  while (trail.size () > size) {
+    const unsigned lit = trail.back ();
+    trail.pop_back ();
+    vals[lit] = vals[lit ^ 1] = 0;
+    for (unsigned i = offsets[lit]; i < offsets[lit+1]; i++)
+      satisfied[occs[i]]--;
+    for (unsigned i = offsets[lit^1]; i < offsets[(lit^1)+1]; i++)
+      falsified[occs[i]]--;
+  }
+  if (propagated > size) propagated = size;
+}
+
+bool Definer::propagate () {
+  while (propagated < trail.size ()) {
+    const unsigned lit = trail[propagated++] ^ 1;
+    for (unsigned i = offsets[lit]; i < offsets[lit+1]; i++) {
+      const unsigned c = occs[i];
+      if (!active[c] || satisfied[c]) continue;
+      const unsigned unassigned = size (c) - falsified[c];
+      if (!unassigned) return false;
+      if (unassigned > 1) continue;
+      ticks += size (c);
+      unsigned j = starts[c];
+      while (vals[lits[j]]) j++;
+      assign (lits[j]);
+    }
+  }
+  return true;
+}
+
+// Pick the first unassigned literal in the first unsatisfied clause.
+// Returns 'UINT_MAX' if all active clauses are satisfied.
+
+unsigned Definer::decide () {
+  for (unsigned c = 0; c < clauses (); c++) {
+    if (!active[c] || satisfied[c]) continue;
+    ticks += size (c);
+    for (unsigned i = starts[c]; i < starts[c+1]; i++)
+      if (!vals[lits[i]]) return lits[i];
+    assert (!"unexpected falsified clause");
+  }
+  return UINT_MAX;
+}
+
+// Returns 10 if satisfiable, 20 if unsatisfiable and zero if the effort
+// limit is hit.
+
+int Definer::solve () {
+  backtrack (0);
+  control.clear ();
+  for (unsigned c = 0; c < clauses (); c++) {
+    if (!active[c]) continue;
+    const unsigned s = size (c);
+    if (!s) return 20;
+    if (s > 1) continue;
+    const unsigned lit = lits[starts[c]];
+    const signed char tmp = vals[lit];
+    if (tmp < 0) return 20;
+    if (!tmp) assign (lit);
+  }
+  for (;;) {
+    if (ticks > limit) return 0;
+    if (!propagate ()) {
+      while (!control.empty () && control.back ().flipped) {
+        backtrack (control.back ().trail);
+        control.pop_back ();
+      }
+      if (control.empty ()) return 20;
+      Decision & decision = control.back ();
+      backtrack (decision.trail);
+      decision.flipped = true;
+      decision.lit ^= 1;
+      assign (decision.lit);
+      continue;
+    }
+    const unsigned lit = decide ();
+    if (lit == UINT_MAX) return 10;
+    control.push_back ({ lit, trail.size (), false });
+    assign (lit);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::find_definition (Eliminator & eliminator, int pivot) {
+
+  if (!opts.elimdefs) return;
+
+  assert (opts.elimsubst);
+
+  if (unsat) return;
+  if (val (pivot)) return;
+  if (!eliminator.gates.empty ()) return;
+
+  const Occs & ps = occs (pivot);
+  const Occs & ns = occs (-pivot);
+  if (ps.size () + ns.size () > (size_t) opts.elimdefocclim) return;
+
+  // Collect the clauses of the pivot, which are not satisfied.
+
+  vector<Clause *> candidates;
+  vector<int> vars;
+  size_t pos = 0;
+  for (int sign = 1; sign >= -1; sign -= 2) {
+    for (const auto & c : occs (sign * pivot)) {
+      if (c->garbage) continue;
+      bool satisfied = false;
+      for (const auto & lit : *c)
+        if (val (lit) > 0) { satisfied = true; break; }
+      if (satisfied) continue;
+      candidates.push_back (c);
+      for (const auto & lit : *c)
+        if (lit != sign * pivot && !val (lit))
+          vars.push_back (abs (lit));
+    }
+    if (sign > 0) pos = candidates.size ();
+  }
+  if (!pos || pos == candidates.size ()) return;
+
+  sort (vars.begin (), vars.end ());
+  vars.resize (unique (vars.begin (), vars.end ()) - vars.begin ());
+
+  stats.elimdeftried++;
+
+  Definer definer (opts.elimdefticks);
+  for (size_t i = 0; i < candidates.size (); i++) {
+    const int except = i < pos ? pivot : -pivot;
+    definer.starts.push_back (definer.lits.size ());
+    for (const auto & lit : *candidates[i]) {
+      if (lit == except || val (lit)) continue;
+      const auto p = lower_bound (vars.begin (), vars.end (), abs (lit));
+      assert (p != vars.end () && *p == abs (lit));
+      definer.lits.push_back (2u * (p - vars.begin ()) + (lit < 0));
+    }
+  }
+  definer.starts.push_back (definer.lits.size ());
+  definer.init (2*vars.size ());
+
+  if (definer.solve () != 20) {
+    LOG ("no definition found for %d", pivot);
+    return;
+  }
+
+  for (size_t i = 0; i < candidates.size (); i++) {
+    definer.active[i] = false;
+    if (definer.solve () != 20) definer.active[i] = true;
+  }
+
+  for (size_t i = 0; i < candidates.size (); i++) {
+    if (!definer.active[i]) continue;
+    Clause * c = candidates[i];
+    assert (!c->gate);
+    c->gate = true;
+    LOG (c, "contributing");
+    eliminator.gates.push_back (c);
+  }
+  eliminator.definition = true;
+
+  LOG ("found definition of %d with %zd out of %zd clauses",
+    pivot, eliminator.gates.size (), candidates.size ());
+
+  stats.elimgates++;
+  stats.elimdefs++;
+}
+
+}
@@ -79,9 +79,10 @@ void
 Internal::elim_update_added_clause (Eliminator & eliminator, Clause * c) {
   assert (!c->redundant);
   ElimSchedule & schedule = eliminator.schedule;
+  const uint64_t sig = signing () ? signature (c) : 0;
   for (const auto & lit : *c) {
     if (!active (lit)) continue;
-    occs (lit).push_back (c);
+    push_occs (lit, c, sig);
     if (frozen (lit)) continue;
     noccs (lit)++;
     const int idx = abs (lit);
@@ -349,6 +350,21 @@ bool Internal::resolve_clauses (Eliminator & eliminator,
 
 /*------------------------------------------------------------------------*/
 
+// With gate clauses only resolvents between a gate and a non-gate clause
+// are needed.  For semantic definitions resolvents between two gate
+// clauses are not tautological though and have to be kept too.
+
+static inline bool
+elim_skip_resolvent (bool substitute, bool definition,
+                     Clause * c, Clause * d)
+{
+  if (!substitute) return false;
+  if (definition) return !c->gate && !d->gate;
+  return c->gate == d->gate;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Check whether the number of non-tautological resolvents on 'pivot' is
 // smaller or equal to the number of clauses with 'pivot' or '-pivot'.  This
 // is the main criteria of bounded variable elimination.  As a side effect
@@ -390,7 +406,8 @@ Internal::elim_resolvents_are_bounded (Eliminator & eliminator, int pivot)
     for (const auto & d : ns) {
       assert (!d->redundant);
       if (d->garbage) continue;
-      if (substitute && c->gate == d->gate) continue;
+      if (elim_skip_resolvent (substitute, eliminator.definition, c, d))
+        continue;
       stats.elimrestried++;
       if (resolve_clauses (eliminator, c, pivot, d)) {
         resolvents++;
@@ -446,7 +463,8 @@ Internal::elim_add_resolvents (Eliminator & eliminator, int pivot) {
     for (auto & d : ns) {
       if (unsat) break;
       if (d->garbage) continue;
-      if (substitute && c->gate == d->gate) continue;
+      if (elim_skip_resolvent (substitute, eliminator.definition, c, d))
+        continue;
       if (!resolve_clauses (eliminator, c, pivot, d)) continue;
       assert (clause.size () <= (size_t) opts.elimclslim);
       Clause * r = new_resolved_irredundant_clause ();
@@ -492,6 +510,7 @@ Internal::mark_eliminated_clauses_as_garbage (Eliminator & eliminator,
     elim_update_removed_clause (eliminator, c, pivot);
   }
   erase_occs (ps);
+  if (signing ()) erase_vector (sigs (pivot));
 
   LOG ("marking irredundant clauses with %d as garbage", -pivot);
 
@@ -507,6 +526,7 @@ Internal::mark_eliminated_clauses_as_garbage (Eliminator & eliminator,
     elim_update_removed_clause (eliminator, d, -pivot);
   }
   erase_occs (ns);
+  if (signing ()) erase_vector (sigs (-pivot));
 
   if (substitute) assert (pushed <= substitute);
 
@@ -517,12 +537,45 @@ Internal::mark_eliminated_clauses_as_garbage (Eliminator & eliminator,
 
 /*------------------------------------------------------------------------*/
 
-// Try to eliminate 'pivot' by bounded variable elimination.
+// Sort the occurrence list of 'lit' with shorter clauses first.  The
+// signatures are kept in a side array parallel to the occurrence list and
+// thus have to be permuted in the same way.  Otherwise backward
+// subsumption would check clauses against the signatures of other clauses
+// and miss subsumed clauses.
 
-void
-Internal::try_to_eliminate_variable (Eliminator & eliminator, int pivot) {
+void Internal::elim_sort_occs (int lit) {
+  Occs & os = occs (lit);
+  if (!signing ()) {
+    stable_sort (os.begin (), os.end (), clause_smaller_size ());
+    return;
+  }
+  Sigs & ss = sigs (lit);
+  assert (ss.size () == os.size ());
+  vector<Signed> sorted;
+  sorted.reserve (os.size ());
+  for (size_t i = 0; i < os.size (); i++)
+    sorted.push_back (Signed (os[i], ss[i]));
+  stable_sort (sorted.begin (), sorted.end (),
+    [] (const Signed & a, const Signed & b) {
+      return a.clause->size < b.clause->size;
+    });
+  for (size_t i = 0; i < os.size (); i++) {
+    os[i] = sorted[i].clause;
+    ss[i] = sorted[i].sig;
+  }
+}
+
+/*------------------------------------------------------------------------*/
 
-  if (!active (pivot)) return;
+// Prepare elimination of 'pivot' by flushing garbage clauses from its
+// occurrence lists, negating it if it occurs more often positively than
+// negatively, sorting its occurrence lists and finding gate clauses.  The
+// result is 'false' if the variable should not be tried at all.
+
+bool
+Internal::elim_prepare_variable (Eliminator & eliminator, int & pivot) {
+
+  if (!active (pivot)) return false;
   assert (!frozen (pivot));
 
   // First flush garbage clauses.
@@ -539,35 +592,342 @@ Internal::try_to_eliminate_variable (Eliminator & eliminator, int pivot) {
   if (pos && neg > opts.elimocclim) {
     LOG ("too many occurrences thus not eliminated %d", pivot);
     assert (!eliminator.schedule.contains (abs (pivot)));
-    return;
+    return false;
   }
 
   LOG ("trying to eliminate %d", pivot);
   assert (!flags (pivot).eliminated ());
 
   // Sort occurrence lists, such that shorter clauses come first.
-  Occs & ps = occs (pivot);
-  stable_sort (ps.begin (), ps.end (), clause_smaller_size ());
-  Occs & ns = occs (-pivot);
-  stable_sort (ns.begin (), ns.end (), clause_smaller_size ());
+  elim_sort_occs (pivot);
+  elim_sort_occs (-pivot);
 
   if (pos) find_gate_clauses (eliminator, pivot);
 
-  if (!unsat && !val (pivot)) {
-    if (elim_resolvents_are_bounded (eliminator, pivot)) {
-      LOG ("number of resolvents on %d are bounded", pivot);
-      elim_add_resolvents (eliminator, pivot);
-      if (!unsat) mark_eliminated_clauses_as_garbage (eliminator, pivot);
-      if (active (pivot)) mark_eliminated (pivot);
-    } else LOG ("too many resolvents on %d so not eliminated", pivot);
-  }
+  return true;
+}
+
+// Eliminate the prepared 'pivot' if the number of resolvents is bounded.
+
+void
+Internal::elim_variable_if_bounded (Eliminator & eliminator, int pivot) {
+  if (unsat || val (pivot)) return;
+  if (elim_resolvents_are_bounded (eliminator, pivot)) {
+    LOG ("number of resolvents on %d are bounded", pivot);
+    elim_add_resolvents (eliminator, pivot);
+    if (!unsat) mark_eliminated_clauses_as_garbage (eliminator, pivot);
+    if (active (pivot)) mark_eliminated (pivot);
+  } else LOG ("too many resolvents on %d so not eliminated", pivot);
+}
 
+// Try to eliminate 'pivot' by bounded variable elimination.
+
+void
+Internal::try_to_eliminate_variable (Eliminator & eliminator, int pivot) {
+  if (!elim_prepare_variable (eliminator, pivot)) return;
+  elim_variable_if_bounded (eliminator, pivot);
   unmark_gate_clauses (eliminator);
   elim_backward_clauses (eliminator);
 }
 
 /*------------------------------------------------------------------------*/
 
+// Parallel variable elimination works on batches of candidates taken from
+// the schedule, whose neighborhoods are pairwise disjoint.  The
+// neighborhood of a variable consists of all variables occurring in
+// (irredundant) clauses together with the variable.  Candidates
+// overlapping with the batch are put back into the schedule.  Eliminating
+// a variable only removes and adds clauses over its neighborhood and
+// thus, as long no new unit is found, does not change the clauses of the
+// other candidates in the batch.
+//
+// Flushing and sorting occurrences and finding gate clauses is done
+// sequentially for all candidates first, since gate extraction might
+// remove clauses and find units.  Then the workers determine in parallel
+// whether the number of resolvents is bounded and if so also generate the
+// resolvents.  This part is a side-effect free version of
+// 'elim_resolvents_are_bounded' and 'resolve_clauses', which only touches
+// the marks of variables in the neighborhood of the candidate.  Finally
+// the batch is committed sequentially in schedule order by adding the
+// resolvents, pushing clauses on the extension stack and eager backward
+// subsumption.  If anything unusual happens, e.g., a resolvent is a unit
+// or an antecedent is satisfied, or a new unit was found while committing
+// the batch, the remaining candidates fall back to the sequential code.
+
+// Stamp the neighborhood of 'idx' unless it overlaps with the batch.
+
+bool Internal::elim_stamp_neighborhood (Eliminator & eliminator, int idx) {
+  const unsigned stamp = eliminator.stamp;
+  vector<unsigned> & stamps = eliminator.stamps;
+  for (int sign = -1; sign <= 1; sign += 2)
+    for (const auto & c : occs (sign * idx)) {
+      if (c->garbage) continue;
+      for (const auto & lit : *c)
+        if (stamps[abs (lit)] == stamp) return false;
+    }
+  for (int sign = -1; sign <= 1; sign += 2)
+    for (const auto & c : occs (sign * idx)) {
+      if (c->garbage) continue;
+      for (const auto & lit : *c)
+        stamps[abs (lit)] = stamp;
+    }
+  stamps[idx] = stamp;
+  return true;
+}
+
+// Side-effect free version of 'resolve_clauses' for workers.  It returns
+// a negative value if 'resolve_clauses' would change the formula, i.e.,
+// if an antecedent is satisfied, the resolvent is empty or a unit, or it
+// subsumes an antecedent, zero for tautological resolvents and otherwise
+// a positive value after appending the zero terminated resolvent.
+
+int Internal::elim_resolve_in_parallel (Clause * c, int pivot, Clause * d,
+                                        vector<int> & resolvents) {
+  assert (!c->redundant);
+  assert (!d->redundant);
+
+  if (c->size > d->size) { pivot = -pivot; swap (c, d); }
+
+  const size_t start = resolvents.size ();
+  int res = 1, s = 0, t = 0;
+
+  for (const auto & lit : *c) {
+    if (lit == pivot) { s++; continue; }
+    const signed char tmp = val (lit);
+    if (tmp > 0) { res = -1; break; }
+    else if (tmp < 0) continue;
+    else mark (lit), resolvents.push_back (lit), s++;
+  }
+
+  if (res > 0) {
+    for (const auto & lit : *d) {
+      if (lit == -pivot) { t++; continue; }
+      signed char tmp = val (lit);
+      if (tmp > 0) { res = -1; break; }
+      else if (tmp < 0) continue;
+      else if ((tmp = marked (lit)) < 0) { res = 0; break; }
+      else if (!tmp) resolvents.push_back (lit), t++;
+      else t++;
+    }
+  }
+
+  unmark (c);
+
+  const int size = resolvents.size () - start;
+  if (res > 0 && (size < 2 || s > size || t > size)) res = -1;
+  if (res > 0) resolvents.push_back (0);
+  else resolvents.resize (start);
+
+  return res;
+}
+
+// Worker part of 'elim_resolvents_are_bounded' and 'elim_add_resolvents'.
+
+void Internal::elim_resolve_candidate (ElimCandidate & candidate) {
+
+  const int pivot = candidate.pivot;
+  const bool substitute = !candidate.gates.empty ();
+
+  const Occs & ps = occs (pivot);
+  const Occs & ns = occs (-pivot);
+  const int64_t pos = ps.size ();
+  const int64_t neg = ns.size ();
+  if (!pos || !neg) {
+    candidate.result = lim.elimbound >= 0 ?
+      ElimCandidate::BOUNDED : ElimCandidate::UNBOUNDED;
+    return;
+  }
+  const int64_t bound = pos + neg + lim.elimbound;
+
+  int64_t resolvents = 0;
+  vector<int> & lits = candidate.resolvents;
+
+  for (const auto & c : ps) {
+    if (c->garbage) continue;
+    for (const auto & d : ns) {
+      if (d->garbage) continue;
+      if (elim_skip_resolvent (substitute, candidate.definition, c, d))
+        continue;
+      candidate.resolutions++;
+      const size_t before = lits.size ();
+      const int res = elim_resolve_in_parallel (c, pivot, d, lits);
+      if (res < 0) {
+        candidate.result = ElimCandidate::FALLBACK;
+        lits.clear ();
+        return;
+      }
+      if (!res) continue;
+      resolvents++;
+      const int64_t size = lits.size () - before - 1;
+      if (size > opts.elimclslim || resolvents > bound) {
+        candidate.result = ElimCandidate::UNBOUNDED;
+        lits.clear ();
+        return;
+      }
+    }
+  }
+
+  candidate.result = ElimCandidate::BOUNDED;
+}
+
+// Add the resolvents generated by a worker and remove the clauses of the
+// now eliminated candidate (in the same way as 'elim_add_resolvents' and
+// 'mark_eliminated_clauses_as_garbage').
+
+void Internal::elim_commit_candidate (Eliminator & eliminator,
+                                      ElimCandidate & candidate) {
+  const int pivot = candidate.pivot;
+  assert (!val (pivot));
+  assert (candidate.result != ElimCandidate::FALLBACK);
+
+  stats.elimtried++;
+  stats.elimres += candidate.resolutions;
+  stats.elimrestried += candidate.resolutions;
+
+  if (candidate.result == ElimCandidate::UNBOUNDED) {
+    LOG ("too many resolvents on %d so not eliminated", pivot);
+    return;
+  }
+
+  if (!eliminator.gates.empty ()) stats.elimsubst++;
+  LOG ("adding all resolvents on %d generated in parallel", pivot);
+
+  const auto & lits = candidate.resolvents;
+  for (auto p = lits.begin (); p != lits.end (); p++) {
+    assert (clause.empty ());
+    while (*p) clause.push_back (*p++);
+    assert (clause.size () <= (size_t) opts.elimclslim);
+    Clause * r = new_resolved_irredundant_clause ();
+    elim_update_added_clause (eliminator, r);
+    eliminator.enqueue (r);
+    clause.clear ();
+  }
+
+  mark_eliminated_clauses_as_garbage (eliminator, pivot);
+  mark_eliminated (pivot);
+}
+
+// Select, prepare, resolve and commit one batch of candidates and return
+// the number of tried variables.
+
+int Internal::elim_batch (Eliminator & eliminator) {
+
+  ElimSchedule & schedule = eliminator.schedule;
+  assert (!schedule.empty ());
+
+  // Variables with too many occurrences are tried sequentially (and are
+  // usually rejected immediately) instead of computing their neighborhood.
+  //
+  const size_t occlim = opts.elimocclim;
+  const auto too_many_occs = [&] (int idx) {
+    return occs (idx).size () > occlim || occs (-idx).size () > occlim;
+  };
+
+  // The batch size is independent of the number of workers, such that
+  // elimination gives the same result for all numbers of threads.
+  //
+  const size_t max_batch = 256;
+
+  vector<unsigned> & stamps = eliminator.stamps;
+  if (stamps.empty ()) stamps.resize (max_var + 1, 0);
+  if (!++eliminator.stamp) {
+    fill (stamps.begin (), stamps.end (), 0);
+    eliminator.stamp = 1;
+  }
+
+  vector<int> candidates, deferred;
+  while (!schedule.empty () &&
+         candidates.size () < max_batch &&
+         deferred.size () < max_batch) {
+    const int idx = schedule.front ();
+    const bool single = active (idx) && too_many_occs (idx);
+    if (single && !candidates.empty ()) break;
+    schedule.pop_front ();
+    if (!single && active (idx) &&
+        !elim_stamp_neighborhood (eliminator, idx)) {
+      deferred.push_back (idx);
+      continue;
+    }
+    flags (idx).elim = false;
+    candidates.push_back (idx);
+    if (single) break;
+  }
+
+  for (const auto & idx : deferred)
+    schedule.push_back (idx);
+
+  const int tried = candidates.size ();
+  if (tried == 1) {
+    try_to_eliminate_variable (eliminator, candidates[0]);
+    return tried;
+  }
+
+  LOG ("eliminating batch of %d candidates (%zd deferred)",
+    tried, deferred.size ());
+
+  // Sequential preparation (including gate extraction).
+  //
+  const size_t units = trail.size ();
+  vector<ElimCandidate> batch;
+  batch.reserve (tried);
+  for (auto idx : candidates) {
+    batch.push_back (ElimCandidate (idx));
+    if (unsat || trail.size () != units) continue;
+    ElimCandidate & candidate = batch.back ();
+    if (elim_prepare_variable (eliminator, idx)) {
+      candidate.pivot = idx;
+      candidate.gates.swap (eliminator.gates);
+      candidate.definition = eliminator.definition;
+      eliminator.definition = false;
+      candidate.prepared = true;
+    } else candidate.pivot = 0;
+  }
+
+  // Parallel resolution, unless preparation already found a unit.
+  //
+  const bool parallel = !unsat && trail.size () == units;
+  if (parallel) {
+    const unsigned workers = parallel_workers (batch.size ());
+    parallel_for (workers, batch.size (),
+      [&] (unsigned, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+          if (batch[i].pivot)
+            elim_resolve_candidate (batch[i]);
+      });
+    stats.elimbatches++;
+    stats.elimbatched += tried;
+  }
+
+  // Sequential commit in schedule order.
+  //
+  for (auto & candidate : batch) {
+    const int pivot = candidate.pivot;
+    if (!pivot) continue;
+    if (!parallel || unsat || trail.size () != units) {
+      for (const auto & c : candidate.gates)
+        assert (c->gate), c->gate = false;
+      if (unsat) continue;
+      if (schedule.contains (abs (pivot))) continue;
+      if (candidate.prepared) stats.elimfallbacks++;
+      try_to_eliminate_variable (eliminator, pivot);
+      continue;
+    }
+    assert (eliminator.gates.empty ());
+    eliminator.gates.swap (candidate.gates);
+    eliminator.definition = candidate.definition;
+    if (candidate.result == ElimCandidate::FALLBACK) {
+      stats.elimfallbacks++;
+      elim_variable_if_bounded (eliminator, pivot);
+    } else elim_commit_candidate (eliminator, candidate);
+    unmark_gate_clauses (eliminator);
+    elim_backward_clauses (eliminator);
+  }
+
+  return tried;
+}
+
+/*------------------------------------------------------------------------*/
+
 void
 Internal::mark_redundant_clauses_with_eliminated_variables_as_garbage () {
   for (const auto & c : clauses) {
@@ -607,6 +967,7 @@ bool Internal::elim_round () {
   if (opts.elimlimited) {
     int64_t delta = stats.propagations.search;
     delta *= 1e-3 * opts.elimreleff;
+    delta *= schedule_effort (schedule.elim);
     if (delta < opts.elimineff) delta = opts.elimineff;
     if (delta > opts.elimaxeff) delta = opts.elimaxeff;
     delta = max (delta, (int64_t) 2l * active ());
@@ -674,13 +1035,17 @@ bool Internal::elim_round () {
     "scheduled %" PRId64 " variables %.0f%% for elimination",
     scheduled, percent (scheduled, active ()));
 
-  // Connect irredundant clauses.
+  // Connect irredundant clauses (with their signatures for eager backward
+  // subsumption if enabled).
   //
-  for (const auto & c : clauses)
-    if (!c->garbage && !c->redundant)
-      for (const auto & lit : *c)
-        if (active (lit))
-          occs (lit).push_back (c);
+  if (opts.signatures && opts.elimbackward) init_sigs ();
+  for (const auto & c : clauses) {
+    if (c->garbage || c->redundant) continue;
+    const uint64_t sig = signing () ? signature (c) : 0;
+    for (const auto & lit : *c)
+      if (active (lit))
+        push_occs (lit, c, sig);
+  }
 
 #ifndef QUIET
   const int64_t old_resolutions = stats.elimres;
@@ -693,6 +1058,10 @@ bool Internal::elim_round () {
   //
   const int64_t garbage_limit = (2*stats.irrbytes/3) + (1<<20);
 
+  // Eliminate batches of candidates in parallel if enabled.
+  //
+  const bool parallel = opts.elimparallel && opts.threads > 1;
+
   // Try eliminating variables according to the schedule.
   //
 #ifndef QUIET
@@ -702,13 +1071,20 @@ bool Internal::elim_round () {
          !terminating () &&
          stats.elimres <= resolution_limit &&
          !schedule.empty ()) {
-    int idx = schedule.front ();
-    schedule.pop_front ();
-    flags (idx).elim = false;
-    try_to_eliminate_variable (eliminator, idx);
+    if (parallel) {
+#ifndef QUIET
+      tried +=
+#endif
+      elim_batch (eliminator);
+    } else {
+      int idx = schedule.front ();
+      schedule.pop_front ();
+      flags (idx).elim = false;
+      try_to_eliminate_variable (eliminator, idx);
 #ifndef QUIET
-    tried++;
+      tried++;
 #endif
+    }
     if (stats.garbage <= garbage_limit) continue;
     mark_redundant_clauses_with_eliminated_variables_as_garbage ();
     garbage_collection ();
@@ -799,9 +1175,11 @@ void Internal::elim (bool update_limits) {
 
   if (unsat) return;
   if (level) backtrack ();
+  reset_cards ();
   if (!propagate ()) { learn_empty_clause (); return; }
 
   stats.elimphases++;
+  begin_recycling_occs ();
 
 #ifndef QUIET
   int old_eliminated = stats.all.eliminated;
@@ -814,6 +1192,10 @@ void Internal::elim (bool update_limits) {
   if (last.elim.subsumephases == stats.subsumephases)
     subsume (update_limits);
 
+  // The forced subsumption phase above is measured by itself.
+  //
+  schedule_begin (schedule.elim);
+
   reset_watches ();             // saves lots of memory
 
   // Alternate blocked clause elimination, variable elimination and
@@ -870,6 +1252,10 @@ void Internal::elim (bool update_limits) {
       stats.elimcompleted + 1, lim.elimbound);
   }
 
+  // Resolvents are often generated several times.
+  //
+  deduplicate_clauses ();
+
   init_watches ();
   connect_watches ();
 
@@ -892,9 +1278,13 @@ void Internal::elim (bool update_limits) {
 
   if (completed) increase_elimination_bound ();
 
+  end_recycling_occs ();
+  schedule_end (schedule.elim, "elim");
+
   if (!update_limits) return;
 
   int64_t delta = scale (opts.elimint * (stats.elimphases + 1));
+  delta *= schedule_interval (schedule.elim);
   lim.elim = stats.conflicts + delta;
 
   PHASE ("elim-phase", stats.elimphases,
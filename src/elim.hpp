@@ -15,12 +15,33 @@ struct elim_more {
 
 typedef heap<elim_more> ElimSchedule;
 
+// Candidate in a batch of parallel variable elimination (see 'elim_batch').
+
+struct ElimCandidate {
+
+  enum Result { FALLBACK = 0, UNBOUNDED = 1, BOUNDED = 2 };
+
+  int pivot;                    // zero if not to be tried
+  bool prepared;                // occurrences flushed and gates found
+  Result result;                // of resolving in parallel
+  int64_t resolutions;          // number of resolutions by worker
+  vector<Clause *> gates;       // saved gate clauses of 'pivot'
+  bool definition;              // gates are a semantic definition
+  vector<int> resolvents;       // zero terminated resolvents
+
+  ElimCandidate (int p) :
+    pivot (p), prepared (false), result (FALLBACK), resolutions (0),
+    definition (false) { }
+};
+
 struct Eliminator {
 
   Internal * internal;
   ElimSchedule schedule;
 
-  Eliminator (Internal * i) : internal (i), schedule (elim_more (i)) { }
+  Eliminator (Internal * i) :
+    internal (i), schedule (elim_more (i)), definition (false), stamp (0)
+  { }
   ~Eliminator ();
 
   queue<Clause*> backward;
@@ -29,7 +50,11 @@ struct Eliminator {
   void enqueue (Clause *);
 
   vector<Clause *> gates;
+  bool definition;              // see 'definition.cpp'
   vector<int> marked;
+
+  vector<unsigned> stamps;      // neighborhoods of parallel batches
+  unsigned stamp;
 };
 
 }
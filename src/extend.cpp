@@ -102,12 +102,10 @@ void External::extend () {
     internal->max_var, max_var);
 
   int64_t updated = 0;
-  for (unsigned i = 1; i <= (unsigned) max_var; i++) {
-    const int ilit = e2i[i];
+  for (const auto & idx : evars) {
+    const int ilit = e2i[idx];
     if (!ilit) continue;
-    while (i >= vals.size ())
-      vals.push_back (false);
-    vals[i] = (internal->val (ilit) > 0);
+    vals.set (idx, internal->val (ilit) > 0);
     updated++;
   }
   PHASE ("extend", internal->stats.extensions,
@@ -139,9 +137,7 @@ void External::extend () {
           assert (lit);
           assert (lit != INT_MIN);
           int idx = abs (lit);
-          while ((size_t) idx >= vals.size ())
-            vals.push_back (false);
-          vals[idx] = !vals[idx];
+          vals.set (idx, !vals[idx]);
           internal->stats.extended++;
           flipped++;
         }
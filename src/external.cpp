@@ -33,33 +33,40 @@ void External::enlarge (int new_max_var) {
 void External::init (int new_max_var) {
   assert (!extended);
   if (new_max_var <= max_var) return;
-  int new_vars = new_max_var - max_var;
-  int old_internal_max_var = internal->max_var;
-  int new_internal_max_var = old_internal_max_var + new_vars;
-  internal->init (new_internal_max_var);
   if ((size_t) new_max_var >= vsize) enlarge (new_max_var);
-  LOG ("initialized %d external variables", new_vars);
   if (!max_var) {
-    assert (e2i.empty ());
-    e2i.push_back (0);
     assert (internal->i2e.empty ());
     internal->i2e.push_back (0);
-  } else {
-    assert (e2i.size () == (size_t) max_var + 1);
-    assert (internal->i2e.size () == (size_t) old_internal_max_var + 1);
+    if (internal->opts.sparse) {
+      LOG ("using sparse external tables");
+      vals.use_sparse (), e2i.use_sparse (), initialized.use_sparse ();
+      witness.use_sparse (), tainted.use_sparse ();
+      frozentab.use_sparse (), moltentab.use_sparse ();
+      introduced.use_sparse ();
+    }
+  }
+  if (internal->opts.sparse) {
+    LOG ("sparse external maximum variable %d", new_max_var);
+    max_var = new_max_var;
+    return;
   }
+  int new_vars = new_max_var - max_var;
+  int old_internal_max_var = internal->max_var;
+  int new_internal_max_var = old_internal_max_var + new_vars;
+  internal->init (new_internal_max_var);
+  LOG ("initialized %d external variables", new_vars);
+  assert (internal->i2e.size () == (size_t) old_internal_max_var + 1);
   int iidx = old_internal_max_var + 1, eidx;
   for (eidx = max_var + 1; eidx <= new_max_var; eidx++, iidx++) {
     LOG ("mapping external %d to internal %d", eidx, iidx);
-    assert (e2i.size () == (size_t) eidx);
-    e2i.push_back (iidx);
+    assert (!initialized[eidx]);
+    initialized.set (eidx, true);
+    evars.push_back (eidx);
+    e2i.set (eidx, iidx);
     internal->i2e.push_back (eidx);
     assert (internal->i2e[iidx] == eidx);
     assert (e2i[eidx] == iidx);
   }
-  if (internal->opts.checkfrozen)
-    while (new_max_var >= (int64_t) moltentab.size ())
-      moltentab.push_back (false);
   assert (iidx == new_internal_max_var + 1);
   assert (eidx == new_max_var + 1);
   max_var = new_max_var;
@@ -93,18 +100,21 @@ int External::internalize (int elit) {
     ilit = e2i [eidx];
     if (elit < 0) ilit = -ilit;
     if (!ilit) {
+      if (!initialized[eidx]) {
+        LOG ("initializing external %d", eidx);
+        initialized.set (eidx, true);
+        evars.push_back (eidx);
+      }
       ilit = internal->max_var + 1;
       internal->init (ilit);
-      e2i[eidx] = ilit;
       LOG ("mapping external %d to internal %d", eidx, ilit);
-      e2i[eidx] = ilit;
+      e2i.set (eidx, ilit);
       internal->i2e.push_back (eidx);
       assert (internal->i2e[ilit] == eidx);
       assert (e2i[eidx] == ilit);
       if (elit < 0) ilit = -ilit;
     }
     if (internal->opts.checkfrozen) {
-      assert (eidx < (int64_t) moltentab.size ());
       if (moltentab[eidx])
         FATAL ("can not reuse molten literal %d", eidx);
     }
@@ -121,9 +131,29 @@ int External::internalize (int elit) {
   return ilit;
 }
 
+// Fresh variables introduced by the solver are allocated after the
+// maximum external variable and are then reserved, i.e., the user is not
+// allowed to use them (see 'check_not_introduced' below).
+
+int External::introduce () {
+  const int eidx = max_var + 1;
+  const int ilit = internalize (eidx);
+  introduced.set (eidx, true);
+  LOG ("introduced external %d as internal %d", eidx, ilit);
+  return ilit;
+}
+
+void External::check_not_introduced (int elit) {
+  assert (elit != INT_MIN);
+  const int eidx = abs (elit);
+  if (eidx <= max_var && introduced[eidx])
+    FATAL ("can not use variable %d introduced by the solver", eidx);
+}
+
 void External::add (int elit) {
   assert (elit != INT_MIN);
   reset_extended ();
+  if (elit) check_not_introduced (elit);
   if (internal->opts.check &&
       (internal->opts.checkwitness || internal->opts.checkfailed))
     original.push_back (elit);
@@ -136,6 +166,7 @@ void External::add (int elit) {
 void External::assume (int elit) {
   assert (elit);
   reset_extended ();
+  check_not_introduced (elit);
   assumptions.push_back (elit);
   const int ilit = internalize (elit);
   assert (ilit);
@@ -189,9 +220,8 @@ void External::check_solve_result (int res) {
 
 void External::update_molten_literals () {
   if (!internal->opts.checkfrozen) return;
-  assert (max_var + 1 == (int64_t) moltentab.size ());
   int registered = 0, molten = 0;
-  for (int lit = 1; lit <= max_var; lit++) {
+  for (const auto & lit : evars) {
     if (moltentab[lit]) {
       LOG ("skipping already molten literal %d", lit);
       molten++;
@@ -199,7 +229,7 @@ void External::update_molten_literals () {
       LOG ("skipping currently frozen literal %d", lit);
     else {
       LOG ("new molten literal %d", lit);
-      moltentab[lit] = true;
+      moltentab.set (lit, true);
       registered++;
       molten++;
     }
@@ -224,13 +254,12 @@ void External::terminate () { internal->terminate (); }
 
 void External::freeze (int elit) {
   reset_extended ();
+  check_not_introduced (elit);
   int ilit = internalize (elit);
   unsigned eidx = vidx (elit);
-  while (eidx >= frozentab.size ())
-    frozentab.push_back (0);
-  unsigned & ref = frozentab[eidx];
+  unsigned ref = frozentab[eidx];
   if (ref < UINT_MAX) {
-    ref++;
+    frozentab.set (eidx, ++ref);
     LOG ("external variable %d frozen once and now frozen %u times",
       eidx, ref);
   } else
@@ -240,13 +269,14 @@ void External::freeze (int elit) {
 
 void External::melt (int elit) {
   reset_extended ();
+  check_not_introduced (elit);
   int ilit = internalize (elit);
   unsigned eidx = vidx (elit);
-  assert (eidx < frozentab.size ());
-  unsigned & ref = frozentab[eidx];
+  unsigned ref = frozentab[eidx];
   assert (ref > 0);
   if (ref < UINT_MAX) {
-    if (!--ref)
+    frozentab.set (eidx, --ref);
+    if (!ref)
       LOG ("external variable %d melted once and now completely melted",
         eidx);
     else
@@ -263,7 +293,7 @@ void External::check_assignment (int (External::*a)(int) const) {
 
   // First check all assigned and consistent.
   //
-  for (int idx = 1; idx <= max_var; idx++) {
+  for (const auto & idx : evars) {
     if (!(this->*a) (idx)) FATAL ("unassigned variable: %d", idx);
     if ((this->*a) (idx) != -(this->*a)(-idx))
       FATAL ("inconsistently assigned literals %d and %d", idx, -idx);
@@ -340,7 +370,7 @@ bool External::traverse_all_frozen_units_as_clauses (ClauseIterator & it) {
 
   vector<int> clause;
 
-  for (int idx = 1; idx <= max_var; idx++) {
+  for (const auto & idx : evars) {
     const int tmp = fixed (idx);
     if (!tmp) continue;
     if (!frozen (idx)) continue;
@@ -363,7 +393,7 @@ External::traverse_all_non_frozen_units_as_witnesses (WitnessIterator & it)
 
   vector<int> clause_and_witness;
 
-  for (int idx = 1; idx <= max_var; idx++) {
+  for (const auto & idx : evars) {
     if (frozen (idx)) continue;
     const int tmp = fixed (idx);
     if (!tmp) continue;
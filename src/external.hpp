@@ -1,6 +1,8 @@
 #ifndef _external_hpp_INCLUDED
 #define _external_hpp_INCLUDED
 
+#include "sparse.hpp"   // Alphabetically after 'external.hpp'.
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -33,6 +35,15 @@ using namespace std;
 // how to support generating incremental proofs in this situation yet).
 //
 // External literals are usually called 'elit' and internal 'ilit'.
+//
+// Tables indexed by external variables are 'Table' objects, which by
+// default are dense vectors and 'init' maps all external variables up to
+// the new maximum variable index to internal variables as before.  With
+// 'opts.sparse' these tables switch to a two-level 'Sparse' representation
+// and only variables actually used in 'add', 'assume', 'freeze' or 'melt'
+// are initialized and mapped.  Then memory scales with the number of used
+// external variables even if they are spread over a huge index range.
+// Loops over external variables only visit those in 'evars'.
 
 /*------------------------------------------------------------------------*/
 
@@ -50,8 +61,11 @@ struct External {
   Internal * internal;    // The actual internal solver.
   int max_var;            // External maximum variable index.
   size_t vsize;
-  vector<bool> vals;      // Current external (extended) assignment.
-  vector<int> e2i;        // External 'idx' to internal 'lit' [1,max_var].
+  Table<bool> vals;      // Current external (extended) assignment.
+  Table<int> e2i;        // External 'idx' to internal 'lit' [1,max_var].
+
+  vector<int> evars;      // Initialized external variables.
+  Table<bool> initialized;
 
   vector<int> assumptions;      // External assumptions.
 
@@ -121,24 +135,21 @@ struct External {
     return 2u*idx + (elit < 0);
   }
 
-  bool marked (const vector<bool> & map, int elit) const {
-    const unsigned ulit = elit2ulit (elit);
-    return ulit < map.size () ? map[ulit] : false;
+  bool marked (const Table<bool> & map, int elit) const {
+    return map[elit2ulit (elit)];
   }
 
-  void mark (vector<bool> & map, int elit) {
-    const unsigned ulit = elit2ulit (elit);
-    while (ulit >= map.size ()) map.push_back (false);
-    map[ulit] = true;
+  void mark (Table<bool> & map, int elit) {
+    map.set (elit2ulit (elit), true);
   }
 
-  void unmark (vector<bool> & map, int elit) {
+  void unmark (Table<bool> & map, int elit) {
     const unsigned ulit = elit2ulit (elit);
-    if (ulit < map.size ()) map[ulit] = false;
+    if (map[ulit]) map.set (ulit, false);
   }
 
-  vector<bool> witness;
-  vector<bool> tainted;
+  Table<bool> witness;
+  Table<bool> tainted;
 
   /*----------------------------------------------------------------------*/
 
@@ -159,7 +170,7 @@ struct External {
   // internally and implicitly assumed literals).  Passes on freezing and
   // melting to the internal solver, which has separate frozen counters.
 
-  vector<unsigned> frozentab;
+  Table<unsigned> frozentab;
 
   void freeze (int elit);
   void melt (int elit);
@@ -169,7 +180,6 @@ struct External {
     assert (elit != INT_MIN);
     int eidx = abs (elit);
     if (eidx > max_var) return false;
-    if (eidx >= (int) frozentab.size ()) return false;
     return frozentab[eidx] > 0;
   }
 
@@ -178,7 +188,17 @@ struct External {
   // marked at the beginning of the 'solve' call.  Note that variables
   // larger than 'max_var' are not molten and can be used in the future.
   //
-  vector<bool> moltentab;
+  Table<bool> moltentab;
+
+  // Variables introduced by the solver itself (currently only by bounded
+  // variable addition) are allocated after 'max_var' and are reserved.
+  // The user can not use them as arguments to 'add', 'assume', 'freeze'
+  // or 'melt', since they already have a meaning in the formula.
+  //
+  Table<bool> introduced;
+
+  int introduce ();                     // Allocate reserved variable.
+  void check_not_introduced (int elit); // Fails on reserved variables.
 
   /*----------------------------------------------------------------------*/
 
@@ -233,7 +253,6 @@ struct External {
     assert (elit != INT_MIN);
     int eidx = abs (elit), res;
     if (eidx > max_var) res = -1;
-    else if ((size_t) eidx >= vals.size ()) res = -1;
     else res = vals[eidx] ? eidx : -eidx;
     if (elit < 0) res = -res;
     return res;
@@ -241,6 +260,12 @@ struct External {
 
   int fixed (int elit) const;   // Implemented in 'internal.hpp'.
 
+  // Backbone extraction with repeated incremental calls to 'solve' in
+  // 'backbone.cpp'.  Returns the result of the first 'solve' call or zero
+  // if interrupted.
+  //
+  int backbone (vector<int> & lits, bool add);
+
   bool failed (int elit);
 
   /*----------------------------------------------------------------------*/
@@ -512,6 +512,7 @@ void Internal::find_gate_clauses (Eliminator & eliminator, int pivot)
   find_and_gate (eliminator, -pivot); // 不是很清楚為什麼 AND gate 就要分正負 pivot 兩種情況，其他 gate 就不用, 我猜應該是因為 AND gate 內部有分主從子句, 意即結構不對稱, 而其他 gate 是對稱的, 就只要試一次就好
   find_if_then_else (eliminator, pivot);
   find_xor_gate (eliminator, pivot);
+  find_definition (eliminator, pivot);
 }
 
 void Internal::unmark_gate_clauses (Eliminator & eliminator) {
@@ -521,6 +522,7 @@ void Internal::unmark_gate_clauses (Eliminator & eliminator) {
     c->gate = false;
   }
   eliminator.gates.clear ();
+  eliminator.definition = false;
 }
 
 /*------------------------------------------------------------------------*/
@@ -0,0 +1,466 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Gaussian elimination on XOR constraints.  We extract XOR constraints
+// from their direct CNF encoding, i.e., a constraint over 'k' variables is
+// found if all '2^(k-1)' clauses blocking the assignments with the wrong
+// parity are present.  These constraints are stored as rows of a packed
+// bit matrix over GF(2) on which we perform Gauss-Jordan elimination.  Rows
+// which end up with a single variable give units, rows with two variables
+// equivalences (exported as binary clauses and then substituted by
+// 'decompose') and an empty row with right-hand side one the empty clause.
+//
+// This is run as part of probing after hyper ternary resolution at the
+// root level and not during search.  Thus there is no need to keep the
+// matrix synchronized with the trail, nor to produce explanations for
+// conflicts and propagations.  Instead all derived facts go through the
+// usual unit and clause learning procedures.  Note that this is not an
+// incremental Gauss-Jordan propagator.  The matrix is not used during
+// search, i.e., neither does it propagate through 'search_assign' nor does
+// it provide reasons for 'analyze'.  It only derives root level units,
+// equivalences and the empty clause in each probing round.
+//
+// In order to support proofs each row addition 'R = R + S' is split into
+// RUP steps.  Let 'U' be the union of the variables of both rows and 'D'
+// their symmetric difference.  First all clauses over 'U' blocking
+// assignments with the wrong parity on 'D' are added.  Each of them is
+// subsumed by a clause of the encoding of 'R' or 'S'.  Then the shared
+// variables are removed one by one, since a clause without the variable is
+// RUP from the two clauses with the variable in both phases.  The final set
+// is the encoding of the new row.  Intermediate clauses as well as the
+// encoding of derived rows are deleted again.  As the number of clauses is
+// exponential in the size of 'U' we only add rows with at most
+// 'gaussprooflim' variables in their union if proofs are generated.
+
+/*------------------------------------------------------------------------*/
+
+struct GaussCandidate {
+  unsigned size;        // number of variables (and literals)
+  unsigned negs;        // negated literals as bit-mask over sorted variables
+  uint64_t hash;        // hash value of sorted variables
+  size_t offset;        // start of sorted variables in 'Gauss::vars'
+};
+
+struct Gauss {
+
+  Internal * internal;
+
+  vector<int> vars;                     // sorted variables of candidates
+  vector<GaussCandidate> candidates;    // clauses with only XOR variables
+
+  vector<int> columns;                  // map columns to variables
+  size_t words;                         // number of words per row
+  vector<uint64_t> bits;                // packed rows
+  vector<char> rhs;                     // right-hand side per row
+  vector<char> derived;                 // row encoding only in proof
+
+  int64_t effort;                       // remaining word operations
+
+  Gauss (Internal * i) : internal (i), words (0), effort (0) { }
+
+  size_t rows () const { return rhs.size (); }
+
+  uint64_t * row (size_t r) { return &bits[r * words]; }
+
+  bool get (size_t r, size_t col) const {
+    return (bits[r * words + col / 64] >> (col & 63)) & 1;
+  }
+
+  void flip (size_t r, size_t col) {
+    bits[r * words + col / 64] ^= (uint64_t) 1 << (col & 63);
+  }
+
+  void swap_rows (size_t r, size_t s) {
+    if (r == s) return;
+    uint64_t * p = row (r), * q = row (s);
+    for (size_t i = 0; i < words; i++) swap (p[i], q[i]);
+    swap (rhs[r], rhs[s]);
+    swap (derived[r], derived[s]);
+  }
+
+  // Get the variables of a row.
+  //
+  void row_vars (size_t r, vector<int> & res) {
+    res.clear ();
+    const uint64_t * p = row (r);
+    for (size_t i = 0; i < words; i++)
+      for (uint64_t w = p[i]; w; w &= w - 1) {
+        size_t col = 64*i + __builtin_ctzll (w);
+        res.push_back (columns[col]);
+      }
+  }
+};
+
+struct gauss_candidate_less_than {
+  const int * vars;
+  gauss_candidate_less_than (const vector<int> & v) : vars (v.data ()) { }
+  bool operator () (const GaussCandidate & a,
+                    const GaussCandidate & b) const {
+    if (a.size < b.size) return true;
+    if (a.size > b.size) return false;
+    if (a.hash < b.hash) return true;
+    if (a.hash > b.hash) return false;
+    for (unsigned i = 0; i < a.size; i++) {
+      const int u = vars[a.offset + i], v = vars[b.offset + i];
+      if (u < v) return true;
+      if (u > v) return false;
+    }
+    return a.negs < b.negs;
+  }
+};
+
+struct gauss_abs_less_than {
+  bool operator () (int a, int b) const { return abs (a) < abs (b); }
+};
+
+/*------------------------------------------------------------------------*/
+
+// Find clauses which might be part of an XOR encoding and group them by
+// their variables.  A group gives an XOR constraint if all clauses of one
+// parity of negated literals are present.  The clause with the negated
+// literals 'negs' blocks the assignment setting exactly the variables in
+// 'negs' to true.  If these clauses have even parity the remaining
+// assignments have odd parity and thus the right-hand side is one.
+
+void Internal::gauss_extract (Gauss & gauss) {
+
+  vector<int> sorted;
+
+  for (const auto & c : clauses) {
+    if (c->garbage || c->redundant) continue;
+    if (c->size < 3 || c->size > opts.gaussxorlim) continue;
+    sorted.clear ();
+    bool assigned = false;
+    for (const auto & lit : *c) {
+      if (val (lit)) { assigned = true; break; }
+      sorted.push_back (lit);
+    }
+    if (assigned) continue;
+    sort (sorted.begin (), sorted.end (), gauss_abs_less_than ());
+    GaussCandidate candidate;
+    candidate.size = c->size;
+    candidate.negs = 0;
+    candidate.hash = 0;
+    candidate.offset = gauss.vars.size ();
+    for (unsigned i = 0; i < candidate.size; i++) {
+      const int lit = sorted[i], idx = abs (lit);
+      if (lit < 0) candidate.negs |= 1u << i;
+      candidate.hash = (candidate.hash + idx) * 0x9e3779b97f4a7c15ull;
+      gauss.vars.push_back (idx);
+    }
+    gauss.candidates.push_back (candidate);
+  }
+
+  LOG ("found %zd XOR candidate clauses", gauss.candidates.size ());
+
+  sort (gauss.candidates.begin (), gauss.candidates.end (),
+        gauss_candidate_less_than (gauss.vars));
+
+  vector<char> seen;
+  vector<int> & columns = gauss.columns;
+  vector<int> column (max_var + 1, -1);
+  vector<GaussCandidate> xors;
+
+  const auto begin = gauss.candidates.begin ();
+  const auto end = gauss.candidates.end ();
+  const int * vars = gauss.vars.data ();
+
+  for (auto i = begin, j = begin; i != end; i = j) {
+
+    const unsigned size = i->size;
+    for (j = i + 1; j != end; j++) {
+      if (j->size != size || j->hash != i->hash) break;
+      if (memcmp (vars + i->offset, vars + j->offset,
+                  size * sizeof (int))) break;
+    }
+
+    const unsigned needed = 1u << (size - 1);
+    if ((unsigned) (j - i) < needed) continue;
+
+    seen.assign (1u << size, 0);
+    unsigned count[2] = { 0, 0 };
+    for (auto k = i; k != j; k++) {
+      if (seen[k->negs]) continue;
+      seen[k->negs] = 1;
+      count[parity (k->negs)]++;
+    }
+
+    for (int p = 0; p < 2; p++) {
+      if (count[p] != needed) continue;
+      LOG ("found XOR constraint over %u variables with parity %d",
+        size, !p);
+      stats.gaussxors++;
+      xors.push_back (*i);
+      gauss.rhs.push_back (!p);
+      for (unsigned k = 0; k < size; k++) {
+        const int idx = vars[i->offset + k];
+        if (column[idx] >= 0) continue;
+        column[idx] = columns.size ();
+        columns.push_back (idx);
+      }
+    }
+  }
+
+  erase_vector (gauss.candidates);
+
+  const size_t rows = gauss.rows ();
+  if (rows) {
+    gauss.words = (columns.size () + 63) / 64;
+    gauss.bits.assign (rows * gauss.words, 0);
+    gauss.derived.assign (rows, 0);
+    for (size_t r = 0; r < rows; r++)
+      for (unsigned k = 0; k < xors[r].size; k++)
+        gauss.flip (r, column[vars[xors[r].offset + k]]);
+  }
+
+  erase_vector (gauss.vars);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Add or delete all clauses over 'vars' which block assignments where the
+// variables selected by 'mask' have a parity different from 'rhs'.  For
+// 'mask' covering all variables this is the CNF encoding of the XOR
+// constraint.  We never delete units (they are fixed anyhow) and deriving
+// the empty clause goes through 'learn_empty_clause'.
+
+void
+Internal::gauss_proof_clauses (const vector<int> & vars,
+                               unsigned mask, bool rhs, bool add) {
+  assert (proof);
+  assert (vars.size () < 32);
+  const unsigned size = vars.size ();
+  if (!add && size < 2) return;
+  assert (clause.empty ());
+  for (unsigned a = 0; a < (1u << size); a++) {
+    if (parity (a & mask) == rhs) continue;
+    if (!size) { learn_empty_clause (); break; }
+    for (unsigned i = 0; i < size; i++)
+      clause.push_back ((a & (1u << i)) ? -vars[i] : vars[i]);
+    if (add) proof->add_derived_clause (clause);
+    else proof->delete_clause (clause);
+    clause.clear ();
+  }
+}
+
+// Trace the row addition 'dst = dst + src' in the proof as described
+// above.  Returns 'false' if the union of variables is too large.
+
+bool Internal::gauss_proof_add_rows (Gauss & gauss,
+                                     size_t dst, size_t src) {
+  assert (proof);
+
+  vector<int> vars, shared;
+
+  const uint64_t * p = gauss.row (dst), * q = gauss.row (src);
+  for (size_t i = 0; i < gauss.words; i++)
+    for (uint64_t w = p[i] | q[i]; w; w &= w - 1) {
+      const unsigned bit = __builtin_ctzll (w);
+      const int idx = gauss.columns[64*i + bit];
+      if ((p[i] & q[i]) >> bit & 1) shared.push_back (idx);
+      else vars.push_back (idx);
+      if ((int) (vars.size () + shared.size ()) > opts.gaussprooflim)
+        return false;
+    }
+
+  const bool rhs = gauss.rhs[dst] ^ gauss.rhs[src];
+  const unsigned mask = (1u << vars.size ()) - 1;
+
+  // Put the shared variables at the end, such that they can be removed
+  // one after the other with 'pop_back' without changing 'mask'.
+  //
+  for (const auto & idx : shared) vars.push_back (idx);
+
+  gauss_proof_clauses (vars, mask, rhs, true);
+  for (size_t i = 0; !unsat && i < shared.size (); i++) {
+    vector<int> previous = vars;
+    vars.pop_back ();
+    gauss_proof_clauses (vars, mask, rhs, true);
+    gauss_proof_clauses (previous, mask, rhs, false);
+  }
+
+  if (gauss.derived[dst]) {
+    gauss.row_vars (dst, vars);
+    gauss_proof_clauses (vars, ~0u, gauss.rhs[dst], false);
+  }
+
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Gauss-Jordan elimination.  The first row with a one in the current
+// column becomes the pivot row which is added to all other rows having a
+// one in that column.  If a row addition can not be traced in the proof
+// that row is just skipped, which leaves the matrix in a valid but not
+// fully reduced state.  The elimination is stopped if the effort limit is
+// hit or the empty clause was derived.
+
+void Internal::gauss_eliminate (Gauss & gauss) {
+
+  const size_t rows = gauss.rows ();
+  const size_t cols = gauss.columns.size ();
+  const size_t words = gauss.words;
+
+  size_t rank = 0;
+
+  for (size_t col = 0; !unsat && col < cols && rank < rows; col++) {
+
+    if (gauss.effort < 0) break;
+
+    size_t pivot = rank;
+    while (pivot < rows && !gauss.get (pivot, col)) pivot++;
+    if (pivot == rows) continue;
+
+    gauss.swap_rows (pivot, rank);
+    gauss.effort -= rows;
+
+    for (size_t r = 0; !unsat && r < rows; r++) {
+      if (r == rank || !gauss.get (r, col)) continue;
+      if (proof && !gauss_proof_add_rows (gauss, r, rank)) {
+        stats.gaussskipped++;
+        continue;
+      }
+      uint64_t * p = gauss.row (r);
+      const uint64_t * q = gauss.row (rank);
+      for (size_t i = 0; i < words; i++) p[i] ^= q[i];
+      gauss.rhs[r] ^= gauss.rhs[rank];
+      gauss.derived[r] = 1;
+      gauss.effort -= words;
+      stats.gaussadded++;
+    }
+
+    rank++;
+  }
+
+  LOG ("Gauss-Jordan elimination reached rank %zd", rank);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Export units, equivalences and the empty clause.  Units are assigned
+// first and propagated before equivalences are added as binary clauses.
+// Returns 'true' if new binary clauses were added.
+
+bool Internal::gauss_export (Gauss & gauss) {
+
+  const size_t rows = gauss.rows ();
+  vector<int> vars;
+
+  for (size_t r = 0; !unsat && r < rows; r++) {
+    gauss.row_vars (r, vars);
+    if (vars.size () > 1) continue;
+    const bool rhs = gauss.rhs[r];
+    if (vars.empty ()) {
+      if (!rhs) continue;
+      LOG ("Gaussian elimination derived empty clause");
+      learn_empty_clause ();
+    } else {
+      const int lit = rhs ? vars[0] : -vars[0];
+      const signed char tmp = val (lit);
+      if (tmp > 0) continue;
+      if (tmp < 0) {
+        LOG ("Gaussian elimination unit %d falsified", lit);
+        learn_empty_clause ();
+      } else {
+        LOG ("Gaussian elimination derived unit %d", lit);
+        stats.gaussunits++;
+        assign_unit (lit);
+      }
+    }
+  }
+
+  if (!unsat && !propagate ()) {
+    LOG ("propagating Gaussian elimination units results in conflict");
+    learn_empty_clause ();
+  }
+
+  int64_t equivalences = 0;
+
+  for (size_t r = 0; !unsat && r < rows; r++) {
+    gauss.row_vars (r, vars);
+    if (vars.size () != 2) continue;
+    int a = vars[0], b = vars[1];
+    if (val (a) || val (b)) continue;
+    if (!gauss.rhs[r]) b = -b;
+    LOG ("Gaussian elimination derived equivalence %d = %d", a, -b);
+    assert (clause.empty ());
+    clause.push_back (a);
+    clause.push_back (b);
+    new_hyper_binary_resolved_clause (true, 2);
+    clause.clear ();
+    clause.push_back (-a);
+    clause.push_back (-b);
+    new_hyper_binary_resolved_clause (true, 2);
+    clause.clear ();
+    gauss.derived[r] = 0;       // Encoding consists of live clauses now.
+    equivalences++;
+  }
+
+  stats.gaussequivs += equivalences;
+
+  // Delete the proof only encodings of derived rows except for exported
+  // equivalences, which are live binary clauses now.
+  //
+  if (proof && !unsat)
+    for (size_t r = 0; r < rows; r++) {
+      if (!gauss.derived[r]) continue;
+      gauss.row_vars (r, vars);
+      gauss_proof_clauses (vars, ~0u, gauss.rhs[r], false);
+    }
+
+  return equivalences > 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::gauss () {
+
+  if (!opts.gauss) return false;
+  if (unsat || terminating ()) return false;
+
+  // No new irredundant clauses added since last time?
+  //
+  if (last.gauss.irredundant == stats.added.irredundant) return false;
+
+  assert (!level);
+  assert (watching ());
+
+  START_SIMPLIFIER (gauss, GAUSS);
+  stats.gauss++;
+
+  Gauss gauss (this);
+  gauss.effort = opts.gaussmaxeff;
+
+  gauss_extract (gauss);
+
+  const int64_t old_units = stats.gaussunits;
+  bool res = false;
+
+  if (gauss.rows () > 1 &&
+      (int64_t) gauss.bits.size () <= opts.gaussmaxeff) {
+    PHASE ("gauss", stats.gauss,
+      "eliminating %zd XOR constraints over %zd variables",
+      gauss.rows (), gauss.columns.size ());
+    gauss_eliminate (gauss);
+    res = gauss_export (gauss);
+  }
+
+  const int64_t units = stats.gaussunits - old_units;
+
+  PHASE ("gauss", stats.gauss,
+    "found %" PRId64 " units and %s equivalences",
+    units, res ? "new" : "no");
+
+  last.gauss.irredundant = stats.added.irredundant;
+
+  STOP_SIMPLIFIER (gauss, GAUSS);
+  report ('x', !opts.reportall && !(units + res));
+
+  return !unsat && res;
+}
+
+}
@@ -123,6 +123,16 @@ public:
   //
   bool empty () const { return array.empty (); }
 
+  // Used and reserved bytes of the heap and position map.
+  //
+  size_t used_bytes () const {
+    return (array.size () + pos.size ()) * sizeof (unsigned);
+  }
+
+  size_t reserved_bytes () const {
+    return (array.capacity () + pos.capacity ()) * sizeof (unsigned);
+  }
+
   // Check whether 'e' is already in the heap.
   //
   bool contains (unsigned e) const {
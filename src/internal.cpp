@@ -20,7 +20,9 @@ Internal::Internal ()
   vsize (0),
   max_var (0),
   level (0),
+  occs_recycling (0),
   vals (0),
+  vals_mapped (0),
   scinc (1.0),
   scores (this),
   conflict (0),
@@ -54,7 +56,7 @@ Internal::~Internal () {
   if (proof) delete proof;
   if (tracer) delete tracer;
   if (checker) delete checker;
-  if (vals) { vals -= vsize; delete [] vals; }
+  delete_vals ();
 }
 
 /*------------------------------------------------------------------------*/
@@ -78,15 +80,24 @@ Internal::~Internal () {
 static signed char * ignore_clang_analyze_memory_leak_warning;
 
 void Internal::enlarge_vals (size_t new_vsize) {
+  size_t new_vals_mapped;
   signed char * new_vals;
-  new_vals = new signed char [ 2*new_vsize ] { 0 };
+  new_vals = (signed char *) new_pages (2*new_vsize, new_vals_mapped);
+  if (!new_vals_mapped) memset (new_vals, 0, 2*new_vsize);
   ignore_clang_analyze_memory_leak_warning = new_vals;
   new_vals += new_vsize;
 
   if (vals) memcpy (new_vals - max_var, vals - max_var, 2*max_var + 1);
-  vals -= vsize;
-  delete [] vals;
+  delete_vals ();
   vals = new_vals;
+  vals_mapped = new_vals_mapped;
+}
+
+void Internal::delete_vals () {
+  if (!vals) return;
+  delete_pages ((char *) (vals - vsize), vals_mapped);
+  vals = 0;
+  vals_mapped = 0;
 }
 
 /*------------------------------------------------------------------------*/
@@ -134,6 +145,11 @@ void Internal::enlarge (int new_max_var) {
   enlarge_zero (phases.min, new_vsize);
   enlarge_zero (marks, new_vsize);
   vsize = new_vsize;
+  advise_huge_pages (wtab);
+  advise_huge_pages (vtab);
+  advise_huge_pages (links);
+  advise_huge_pages (btab);
+  advise_huge_pages (stab);
 }
 
 void Internal::init (int new_max_var) {
@@ -200,9 +216,12 @@ int Internal::cdcl_loop_with_inprocessing () {
     else if (eliminating ()) elim ();        // variable elimination
     else if (compacting ()) compact ();      // collect variables
     else if (conditioning ()) condition ();  // globally blocked clauses
+    else if (detecting_cards ()) detect_cards (); // at-most-one constraints
     else res = decide ();                    // next decision
   }
 
+  reset_cards ();
+
   if (stable) { STOP (stable);   report (']'); }
   else        { STOP (unstable); report ('}'); }
 
@@ -442,11 +461,27 @@ bool Internal::preprocess_round (int round) {
   return false; // 沒有進步，試再多次都一樣
 }
 
+// Structural simplifications which only make sense once before search.
+
+void Internal::preprocess_structure () {
+  assert (!preprocessing);
+  preprocessing = true;
+  if (congruence ())    // Equivalences from congruent gates
+    decompose ();       // are substituted right away.
+  if (bvaing ()) bva ();
+  assert (preprocessing);
+  preprocessing = false;
+}
+
 int Internal::preprocess () { // used in line 588
-  if (opts.simplify)
+  if (opts.simplify) {
+    begin_recycling_occs ();
+    preprocess_structure ();
     for (int i = 0; i < lim.preprocessing; i++)
       if (!preprocess_round (i))
         break;
+    end_recycling_occs ();
+  }
   if (unsat) return 20;
   return 0;
 }
@@ -587,6 +622,10 @@ int Internal::solve () {
 
     if (!res) res = preprocess (); // line 445
     if (!res) res = local_search (); // line 531, which runs "random walk local search" based on 'ProbSAT' ideas. (所以先不去 trace 它)
+    if (!res && autarkying ()) {
+      autarky ();               // Uses phases of local search.
+      if (unsat) res = 20;
+    }
     if (!res) res = lucky_phases (); // line 292 of lucky.cpp
     if (!res) {
       if (terminating ()) res = 0;
@@ -62,10 +62,13 @@ extern "C" {
 #include "level.hpp"
 #include "limit.hpp"
 #include "logging.hpp"
+#include "memory.hpp"
 #include "message.hpp"
 #include "observer.hpp"
 #include "occs.hpp"
 #include "options.hpp"
+#include "pages.hpp"
+#include "parallel.hpp"
 #include "parse.hpp"
 #include "phases.hpp"
 #include "profile.hpp"
@@ -75,6 +78,7 @@ extern "C" {
 #include "random.hpp"
 #include "reluctant.hpp"
 #include "resources.hpp"
+#include "schedule.hpp"
 #include "score.hpp"
 #include "stats.hpp"
 #include "terminal.hpp"
@@ -91,8 +95,16 @@ namespace CaDiCaL {
 
 using namespace std;
 
+struct CGate;
+struct Closure;
 struct Coveror;
 struct External;
+struct Gauss;
+struct ProbeResult;
+struct Stamp;
+struct Sweeper;
+struct SubsumeSegment;
+struct VivifyResult;
 struct Walker;
 
 /*------------------------------------------------------------------------*/
@@ -105,21 +117,27 @@ struct Internal {
   // section.  This is currently only used for debugging and testing.
 
   enum Mode {
-    BLOCK    = (1<<0),
-    CONDITION= (1<<1),
-    COVER    = (1<<2),
-    DECOMP   = (1<<3),
-    DEDUP    = (1<<4),
-    ELIM     = (1<<5),
-    LUCKY    = (1<<6),
-    PROBE    = (1<<7),
-    SEARCH   = (1<<8),
-    SIMPLIFY = (1<<9),
-    SUBSUME  = (1<<10),
-    TERNARY  = (1<<11),
-    TRANSRED = (1<<12),
-    VIVIFY   = (1<<13),
-    WALK     = (1<<14),
+    AUTARKY  = (1<<0),
+    BLOCK    = (1<<1),
+    BVA      = (1<<2),
+    CONDITION= (1<<3),
+    CONGRUENCE= (1<<4),
+    COVER    = (1<<5),
+    DECOMP   = (1<<6),
+    DEDUP    = (1<<7),
+    ELIM     = (1<<8),
+    GAUSS    = (1<<9),
+    LUCKY    = (1<<10),
+    PROBE    = (1<<11),
+    SEARCH   = (1<<12),
+    SIMPLIFY = (1<<13),
+    SUBSUME  = (1<<14),
+    SWEEP    = (1<<15),
+    TERNARY  = (1<<16),
+    TRANSRED = (1<<17),
+    UNHIDE   = (1<<18),
+    VIVIFY   = (1<<19),
+    WALK     = (1<<20),
   };
 
   int mode;
@@ -145,7 +163,9 @@ struct Internal {
   size_t vsize;                 // actually allocated variable data size
   int max_var;                  // internal maximum variable index
   int level;                    // decision level ('control.size () - 1')
+  int occs_recycling;           // nesting depth of recycling occurrences
   signed char * vals;           // assignment [-max_var,max_var]
+  size_t vals_mapped;           // mapped bytes of 'vals' (see 'pages.hpp')
   vector<signed char> marks;    // signed marks [1,max_var]
   Phases phases;                // saved, target and best phases
   vector<unsigned> frozentab;   // frozen counters [1,max_var]
@@ -160,11 +180,17 @@ struct Internal {
   vector<int64_t> btab;         // enqueue time stamps for queue, b 應該是 bump 的意思
   vector<int64_t> gtab;         // time stamp table to recompute glue
   vector<Occs> otab;            // table of occurrences for all literals
+  vector<Sigs> itab;            // signatures parallel to 'otab'
+  vector<Occs> recycled_otab;   // cleared 'otab' kept for recycling
+  vector<Sigs> recycled_itab;   // cleared 'itab' kept for recycling
   vector<int> ptab;             // table for caching probing attempts
   vector<int64_t> ntab;         // number of one-sided occurrences table
   vector<int64_t> ntab2;        // number of two-sided occurrences table
   vector<Bins> big;             // binary implication graph
   vector<Watches> wtab;         // table of watches for all literals
+  vector<int> cards;            // zero terminated at-most-one constraints
+  vector<vector<unsigned>> ctab;// constraint offsets in 'cards' per literal
+  vector<Clause> rtab;          // at-most-one reason clauses [0,max_var]
   Clause * conflict;            // set in 'propagation', reset in 'analyze'
   Clause * ignore;              // ignored during 'vivify_propagate'
   size_t propagated;            // next trail position to propagate
@@ -186,6 +212,7 @@ struct Internal {
   Limit lim;                    // limits for various phases
   Last last;                    // statistics at last occurrence
   Inc inc;                      // increments on limits
+  Schedule schedule;            // payoff driven inprocessing schedule
   Proof * proof;                // clausal proof observers if non zero
   Checker * checker;            // online proof checker observing proof
   Tracer * tracer;              // proof to file tracer observing proof
@@ -198,6 +225,7 @@ struct Internal {
   Arena arena;                  // memory arena for moving garbage collector
   Format error_message;         // provide persistent error message
   Clause binary_subsuming;      // communicate binary subsuming clause
+  vector<Signed> eager;         // signatures of recently learned clauses
   string prefix;                // verbose messages prefix
 
   Internal * internal;          // proxy to 'this' in macros
@@ -222,9 +250,25 @@ struct Internal {
 
   void add_original_lit (int lit);
 
+  // Allocation of large memory regions in 'pages.cpp'.
+  //
+  char * new_pages (size_t bytes, size_t & mapped);
+  void release_pages (char *, size_t mapped);
+  void delete_pages (char *, size_t mapped);
+  void advise_huge_pages (const void *, size_t bytes);
+
+  template<class T> void advise_huge_pages (const vector<T> & v) {
+    advise_huge_pages (v.data (), v.capacity () * sizeof (T));
+  }
+
+  // Number of workers for parallel phases in 'parallel.cpp'.
+  //
+  unsigned parallel_workers (size_t size);
+
   // Enlarge tables.
   //
   void enlarge_vals (size_t new_vsize);
+  void delete_vals ();
   void enlarge (int new_max_var);
 
   // A variable is 'active' if it is not eliminated nor fixed.
@@ -302,6 +346,8 @@ struct Internal {
 
   Bins & bins (int lit) { assert (!big.empty ()); return big[vlit (lit)]; }
   Occs & occs (int lit) { assert (!otab.empty ()); return otab[vlit (lit)]; }
+  Sigs & sigs (int lit) { assert (!itab.empty ()); return itab[vlit (lit)]; }
+  bool signing () const { return !itab.empty (); }
   int64_t & noccs (int lit) { assert (!ntab.empty ()); return ntab[vlit (lit)]; }
   int64_t & noccs2 (int lit) { assert (!ntab2.empty ()); return ntab2[vidx (lit)]; }
   Watches & watches (int lit) { assert (!wtab.empty ()); return wtab[vlit (lit)]; }
@@ -483,6 +529,7 @@ struct Internal {
   void search_assign_driving (int lit, Clause * reason);
   void search_assume_decision (int decision);
   void assign_unit (int lit);
+  void propagate_cards (int lit);
   bool propagate ();
 
   // Undo and restart in 'backtrack.cpp'.
@@ -583,10 +630,12 @@ struct Internal {
   int clause_contains_fixed_literal (Clause *);
   void remove_falsified_literals (Clause *);
   void mark_satisfied_clauses_as_garbage ();
+  void schedule_clause_copy (vector<Clause*> &, Clause *);
   void copy_clause (Clause *);
+  void copy_clauses_in_parallel (vector<Clause*> &, unsigned workers);
   void flush_watches (int lit, Watches &);
   size_t flush_occs (int lit);
-  void flush_all_occs_and_watches ();
+  void flush_all_occs_and_watches (unsigned workers = 1);
   void copy_non_garbage_clauses ();
   void delete_garbage_clauses ();
   void check_clause_stats ();
@@ -596,12 +645,19 @@ struct Internal {
 
   // Set-up occurrence list counters and containers.
   //
+  void begin_recycling_occs ();
+  void end_recycling_occs ();
   void init_occs ();
+  void init_sigs ();
+  uint64_t signature (Clause *);
+  void push_occs (int lit, Clause *, uint64_t sig);
   void init_bins ();
+  void init_bin_graph (BinGraph &, bool irredundant_only = false);
   void init_noccs ();
   void init_watches ();
   void clear_watches ();
   void reset_occs ();
+  void reset_sigs ();
   void reset_bins ();
   void reset_noccs ();
   void reset_watches ();
@@ -619,6 +675,10 @@ struct Internal {
   void subsume_clause (Clause * subsuming, Clause * subsumed);
   int subsume_check (Clause * subsuming, Clause * subsumed);
   int try_to_subsume_clause (Clause *, vector<Clause*> & shrunken);
+  void subsume_segment_in_parallel (SubsumeSegment &);
+  int try_to_subsume_clause_in_segment (Clause *, size_t,
+                                        SubsumeSegment &,
+                                        vector<Clause*> & shrunken);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume (bool update_limits = true);
@@ -646,18 +706,31 @@ struct Internal {
   void vivify_assume (int lit);
   bool vivify_propagate ();
   void vivify_clause (Vivifier &, Clause * candidate);
+  void vivify_apply_result (Vivifier &, Clause * candidate, VivifyResult &);
+  void vivify_in_parallel (Vivifier &, int64_t limit);
   void vivify_round (bool redundant_mode, int64_t delta);
   void vivify ();
 
   // Compacting (shrinking internal variable tables) in 'compact.cpp'
   //
   bool compacting ();
+  void compact_queue_order (vector<int> &);
+  void compact_bfs_order (vector<int> &);
   void compact ();
 
   // Transitive reduction of binary implication graph in 'transred.cpp'
   //
   void transred ();
 
+  // Unhiding through time stamping the binary implication graph in
+  // 'unhide.cpp'.
+  //
+  bool unhide_stamp (const BinGraph &, Stamp *, Random &, int64_t & ticks);
+  bool unhide_hidden_tautology (Clause *, const Stamp *, bool cyclic);
+  void unhide_hidden_literals (Clause *, const Stamp *, vector<int> &);
+  bool unhide_round (int round, int64_t & ticks, int64_t limit);
+  void unhide ();
+
   // We monitor the maximum size and glue of clauses during 'reduce' and
   // thus can predict if a redundant extended clause is likely to be kept in
   // the next 'reduce' phase.  These clauses are target of subsumption and
@@ -789,6 +862,10 @@ struct Internal {
 
   void find_if_then_else (Eliminator &, int pivot);
 
+  // Semantic gate extraction in 'definition.cpp'.
+  //
+  void find_definition (Eliminator &, int pivot);
+
   void find_gate_clauses (Eliminator &, int pivot);
   void unmark_gate_clauses (Eliminator &);
 
@@ -809,7 +886,15 @@ struct Internal {
   void elim_backward_clauses (Eliminator &);
   void elim_propagate (Eliminator &, int unit);
   void elim_on_the_fly_self_subsumption (Eliminator &, Clause *, int);
+  void elim_sort_occs (int lit);
+  bool elim_prepare_variable (Eliminator &, int & pivot);
+  void elim_variable_if_bounded (Eliminator &, int pivot);
   void try_to_eliminate_variable (Eliminator &, int pivot);
+  bool elim_stamp_neighborhood (Eliminator &, int idx);
+  int elim_resolve_in_parallel (Clause *, int pivot, Clause *, vector<int> &);
+  void elim_resolve_candidate (ElimCandidate &);
+  void elim_commit_candidate (Eliminator &, ElimCandidate &);
+  int elim_batch (Eliminator &);
   void increase_elimination_bound ();
   bool elim_round ();
   void elim (bool update_limits = true);
@@ -831,6 +916,61 @@ struct Internal {
   bool ternary_round (int64_t & steps, int64_t & htrs);
   bool ternary ();
 
+  // Autarky detection and removal in 'autarky.cpp'.
+  //
+  bool autarkying ();
+  void autarky ();
+
+  // Bounded variable addition in 'bva.cpp'.
+  //
+  bool bvaing ();
+  int bva_fresh_variable ();
+  Clause * bva_find_clause (Clause *, int other);
+  bool bva_lit (int lit, int64_t & effort);
+  void bva ();
+
+  // Native at-most-one constraints in 'cardinality.cpp'.
+  //
+  bool detecting_cards ();
+  bool card_connected (int, int);
+  void unwatch_card_clauses ();
+  void init_card_reasons ();
+  void detect_cards ();
+  void reset_cards ();
+
+  // Gaussian elimination on XOR constraints in 'gauss.cpp'.
+  //
+  void gauss_extract (Gauss &);
+  void gauss_proof_clauses (const vector<int> &, unsigned, bool, bool);
+  bool gauss_proof_add_rows (Gauss &, size_t dst, size_t src);
+  void gauss_eliminate (Gauss &);
+  bool gauss_export (Gauss &);
+  bool gauss ();
+
+  // Congruence closure on extracted gates in 'congruence.cpp'.
+  //
+  bool congruence_find_ternary (int, int, int);
+  void congruence_extract_ands (Closure &, Clause *, int64_t & ticks);
+  void congruence_extract_xors (Closure &, Clause *, int64_t & ticks);
+  void congruence_extract_ites (Closure &, Clause *, int64_t & ticks);
+  bool congruence_normalize (Closure &, CGate &);
+  bool congruence_merge (Closure &, const CGate &, int a, int b);
+  bool congruence ();
+
+  // SAT sweeping with an embedded sub-solver in 'sweep.cpp'.
+  //
+  void sweep_environment (Sweeper &, int idx);
+  bool sweep_variable (Sweeper &, int idx);
+  bool sweep ();
+
+  // Payoff driven inprocessing schedule in 'schedule.cpp'.
+  //
+  double schedule_cost ();
+  void schedule_begin (Payoff &);
+  void schedule_end (Payoff &, const char * name);
+  double schedule_effort (const Payoff &);
+  double schedule_interval (const Payoff &);
+
   // Probing in 'probe.cpp'.
   //
   bool probing ();
@@ -839,6 +979,7 @@ struct Internal {
   void probe_assign_decision (int lit);
   void probe_assign (int lit, int parent);
   void mark_duplicated_binary_clauses_as_garbage ();
+  void deduplicate_clauses ();
   int probe_dominator (int a, int b);
   int hyper_binary_resolve (Clause*);
   void probe_propagate2 ();
@@ -847,6 +988,11 @@ struct Internal {
   void generate_probes ();
   void flush_probes ();
   int next_probe ();
+  void next_probes (vector<int> & segment, size_t max);
+  void probe_apply_result (int probe, ProbeResult &, int64_t fixed);
+  void probe_in_parallel (int64_t limit);
+  bool probe_tree_decide (int lit);
+  void probe_trees (int64_t limit);
   bool probe_round ();
   void probe (bool update_limits = true);
 
@@ -949,6 +1095,7 @@ struct Internal {
   // with inprocessing.  This is all orchestrated by the 'solve' function.
   //
   bool preprocess_round (int round);
+  void preprocess_structure ();
   int preprocess ();
   //
   int local_search_round (int round);
@@ -1067,6 +1214,12 @@ struct Internal {
 
   void print_stats ();          // Complete statistics.
 
+  // Used and reserved bytes per subsystem in 'memory.cpp'.  The second
+  // function returns the total number of reserved bytes.
+  //
+  void memory_usage (Memory &);
+  size_t memory_usage ();
+
   /*----------------------------------------------------------------------*/
 
 #ifndef QUIET
@@ -39,11 +39,14 @@ struct Limit {
 };
 
 struct Last {
-  struct { int64_t propagations; } transred, vivify;
+  struct { int64_t propagations; } transred, unhide, vivify;
   struct { int64_t fixed, subsumephases, marked; } elim;
   struct { int64_t propagations, reductions; } probe;
   struct { int64_t conflicts; } reduce, rephase;
   struct { int64_t marked; } ternary;
+  struct { int64_t irredundant; } autarky, bva, congruence, gauss;
+  struct { int64_t irredundant, next; } sweep;
+  struct { int64_t irredundant, found; } card;
   struct { int64_t fixed; } collect;
   Last ();
 };
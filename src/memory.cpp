@@ -0,0 +1,102 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Memory accounting does not allocate memory and does not traverse
+// clauses.  Clauses allocated outside of the arena and the clauses of the
+// internal proof checker are accounted by running byte counters updated
+// on allocation and deallocation.  Only per variable tables are traversed
+// (for instance to sum up the sizes of watch lists).  Thus it is cheap
+// enough to be called for every report line.  Clauses allocated outside
+// of the arena are accounted with their current size, which is less than
+// their allocated size if they were shrunken.
+
+void Internal::memory_usage (Memory & m) {
+
+  m.arena.add (arena.used_bytes (), arena.reserved_bytes ());
+
+  m.clauses.add (clauses);
+  m.clauses.add (eager);
+  m.clauses.add (cards);
+  m.clauses.add (rtab);
+  m.clauses.add (stats.heapbytes, stats.heapbytes);
+
+  m.watches.add_nested (wtab);
+  m.occs.add_nested (otab);
+  m.occs.add_nested (itab);
+  m.occs.add_nested (recycled_otab);
+  m.occs.add_nested (recycled_itab);
+  m.occs.add (ntab);
+  m.occs.add (ntab2);
+  m.occs.add_nested (ctab);
+  m.big.add_nested (big);
+
+  m.extension.add (external->extension);
+  m.extension.add (external->witness);
+  m.extension.add (external->tainted);
+
+  m.external.add (external->e2i);
+  m.external.add (external->vals);
+  m.external.add (external->evars);
+  m.external.add (external->initialized);
+  m.external.add (external->frozentab);
+  m.external.add (external->moltentab);
+  m.external.add (external->introduced);
+  m.external.add (external->assumptions);
+  m.external.add (external->original);
+
+  if (proof) proof->memory_usage (m.proof);
+  if (checker) checker->memory_usage (m.proof);
+  if (tracer) tracer->memory_usage (m.proof);
+
+  const size_t vals_bytes = 2*vsize;
+  m.variables.add (vals_bytes, vals_mapped ? vals_mapped : vals_bytes);
+  m.variables.add (vtab);
+  m.variables.add (ftab);
+  m.variables.add (marks);
+  m.variables.add (frozentab);
+  m.variables.add (i2e);
+  m.variables.add (ptab);
+  m.variables.add (gtab);
+
+  m.phases.add (phases.saved);
+  m.phases.add (phases.target);
+  m.phases.add (phases.best);
+  m.phases.add (phases.prev);
+  m.phases.add (phases.min);
+
+  m.scores.add (stab);
+  m.scores.add (scores.used_bytes (), scores.reserved_bytes ());
+
+  m.queue.add (links);
+  m.queue.add (btab);
+
+  m.trail.add (trail);
+  m.trail.add (control);
+  m.trail.add (clause);
+  m.trail.add (levels);
+  m.trail.add (analyzed);
+  m.trail.add (minimized);
+  m.trail.add (probes);
+  m.trail.add (assumptions);
+  m.trail.add (original);
+}
+
+size_t Internal::memory_usage () {
+  Memory m;
+  memory_usage (m);
+  return m.total ().reserved;
+}
+
+Bytes Memory::total () const {
+  Bytes res;
+#define MEMORY(NAME) \
+  res.add (NAME);
+  MEMORY_SUBSYSTEMS
+#undef MEMORY
+  return res;
+}
+
+}
@@ -0,0 +1,71 @@
+#ifndef _memory_hpp_INCLUDED
+#define _memory_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// Accounting of used and reserved (allocated) bytes per subsystem, which
+// is returned by 'Solver::memory_usage' and printed with the statistics.
+// Used bytes are those actually holding data, while reserved bytes also
+// include the unused capacity of vectors, the arena and mapped pages.
+//
+// To add another subsystem add a corresponding line here and account its
+// data structures in 'Internal::memory_usage' in 'memory.cpp'.
+
+#define MEMORY_SUBSYSTEMS \
+MEMORY(arena) \
+MEMORY(clauses) \
+MEMORY(watches) \
+MEMORY(occs) \
+MEMORY(big) \
+MEMORY(extension) \
+MEMORY(external) \
+MEMORY(proof) \
+MEMORY(variables) \
+MEMORY(phases) \
+MEMORY(scores) \
+MEMORY(queue) \
+MEMORY(trail) \
+
+// Note, keep an empty line before this line (because of '\')!
+
+template<class T> class Table;
+
+struct Bytes {
+
+  size_t used, reserved;
+
+  Bytes () : used (0), reserved (0) { }
+
+  void add (size_t u, size_t r) { used += u, reserved += r; }
+  void add (const Bytes & b) { add (b.used, b.reserved); }
+
+  template<class T> void add (const vector<T> & v) {
+    add (v.size () * sizeof (T), v.capacity () * sizeof (T));
+  }
+
+  template<class T> void add (const Table<T> & s) {
+    const size_t bytes = s.bytes ();
+    add (bytes, bytes);
+  }
+
+  // Tables of vectors, such as watch and occurrence lists.
+  //
+  template<class T> void add_nested (const vector<vector<T>> & v) {
+    add (v);
+    for (const auto & w : v) add (w);
+  }
+};
+
+struct Memory {
+#define MEMORY(NAME) \
+  Bytes NAME;
+  MEMORY_SUBSYSTEMS
+#undef MEMORY
+  Bytes total () const;
+};
+
+}
+
+#endif
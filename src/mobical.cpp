@@ -718,6 +718,7 @@ public:
   ~Trace () { clear (); }
 
   void push_back (Call * c) { calls.push_back (c); }
+  void insert (size_t i, Call * c) { calls.insert (calls.begin () + i, c); }
 
   void print (ostream & o) {
     for (size_t i = 0; i < calls.size (); i++)
@@ -889,6 +890,7 @@ static bool has_prefix (const char * str, const char * prefix) {
 }
 
 static bool disabled_if_not_simplifying (const char * name) {
+  if (has_prefix (name, "autarky")) return true;
   if (has_prefix (name, "block")) return true;
   if (has_prefix (name, "compact")) return true;
   if (has_prefix (name, "decompose")) return true;
@@ -898,6 +900,7 @@ static bool disabled_if_not_simplifying (const char * name) {
   if (has_prefix (name, "preprocessing")) return true;
   if (has_prefix (name, "subsume")) return true;
   if (has_prefix (name, "transred")) return true;
+  if (has_prefix (name, "unhide")) return true;
   if (has_prefix (name, "vivify")) return true;
   return false;
 }
@@ -1018,6 +1021,18 @@ void Trace::generate_options (Random & random, Size size) {
   if (random.generate_double () < 0.8)
     push_back (new SetCall ("check", 1));
 
+  // The parallel versions of elimination, probing, subsumption,
+  // vivification and garbage collection are only used with more than one
+  // worker thread.  Thus we enable a few worker threads in half of the
+  // tests, but not too many, since small formulas are the common case.
+  // For the same reason the minimum number of work items per thread is
+  // kept small, since otherwise these formulas never use threads.
+  //
+  if (random.generate_double () < 0.5) {
+    push_back (new SetCall ("threads", random.pick_int (2, 8)));
+    push_back (new SetCall ("threadschunk", random.pick_int (1, 16)));
+  }
+
   // This is the fraction of options changed.
   //
   double fraction = random.generate_double ();
@@ -1034,11 +1049,12 @@ void Trace::generate_options (Random & random, Size size) {
     //
     if (o.lo == o.hi) continue;
 
-    // We keep choosing the value for 'simplify' and 'walk' out of the loop
-    // (see the arguments described above).
+    // We keep choosing the value for 'simplify', 'walk' and the 'threads'
+    // options out of the loop (see the arguments described above).
     //
     if (!strcmp (o.name, "simplify")) continue;
     if (!strcmp (o.name, "walk")) continue;
+    if (has_prefix (o.name, "threads")) continue;
 
     // Probability to change an option is 'fraction'.
     //
@@ -1342,6 +1358,13 @@ void Trace::generate (uint64_t i, uint64_t s) {
     generate_frozen (random, maxvars);
   }
 
+  // Variables added by 'bva' are reserved and can not be used afterwards.
+  // Thus all variables of the trace have to be reserved before solving.
+  //
+  Call * c = find_option_by_name ("bva");
+  if (c && c->val)
+    insert (last_option (), new ReserveCall (vars ()));
+
   push_back (new ResetCall ());
 }
 
@@ -4,9 +4,34 @@ namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
 
-// Occurrence lists.
+// Occurrence lists.  Most procedures using them connect clauses from
+// scratch and reset the lists afterwards.  Between 'begin_recycling_occs'
+// and 'end_recycling_occs', e.g., during 'elim' with its interleaved
+// subsumption, blocked and covered clause elimination rounds, or during a
+// whole preprocessing round, resetting only clears the lists and keeps
+// them for recycling.  Thus the next 'init_occs' reuses the allocated
+// memory instead of growing every list again from scratch.  Note that
+// this only recycles allocations.  The lists are still connected from
+// scratch each time and are not maintained incrementally.
+
+void Internal::begin_recycling_occs () {
+  occs_recycling++;
+  LOG ("begin recycling occurrence lists at depth %d", occs_recycling);
+}
+
+void Internal::end_recycling_occs () {
+  assert (occs_recycling > 0);
+  LOG ("end recycling occurrence lists at depth %d", occs_recycling);
+  if (--occs_recycling) return;
+  erase_vector (recycled_otab);
+  erase_vector (recycled_itab);
+}
 
 void Internal::init_occs () {
+  if (!occurring () && !recycled_otab.empty ()) {
+    swap (otab, recycled_otab);
+    if (otab.size () > 2*vsize) otab.resize (2*vsize);
+  }
   while (otab.size () < 2*vsize)
     otab.push_back (Occs ());
   LOG ("initialized occurrence lists");
@@ -14,8 +39,60 @@ void Internal::init_occs () {
 
 void Internal::reset_occs () {
   assert (occurring ());
-  erase_vector (otab);
-  LOG ("reset occurrence lists");
+  reset_sigs ();
+  if (occs_recycling) {
+    assert (recycled_otab.empty ());
+    for (auto & os : otab) os.clear ();
+    swap (otab, recycled_otab);
+    LOG ("cleared occurrence lists for recycling");
+  } else {
+    erase_vector (otab);
+    LOG ("reset occurrence lists");
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Signatures of clauses in occurrence lists (see 'occs.hpp').
+
+uint64_t Internal::signature (Clause * c) {
+  uint64_t res = 0;
+  for (const auto & lit : *c)
+    res |= signature_bit (lit);
+  return res;
+}
+
+void Internal::init_sigs () {
+  assert (occurring ());
+  assert (!signing ());
+  if (!recycled_itab.empty ()) {
+    swap (itab, recycled_itab);
+    if (itab.size () > 2*vsize) itab.resize (2*vsize);
+  }
+  while (itab.size () < 2*vsize)
+    itab.push_back (Sigs ());
+  LOG ("initialized signature lists");
+}
+
+void Internal::reset_sigs () {
+  if (!signing ()) return;
+  if (occs_recycling) {
+    assert (recycled_itab.empty ());
+    for (auto & ss : itab) ss.clear ();
+    swap (itab, recycled_itab);
+    LOG ("cleared signature lists for recycling");
+  } else {
+    erase_vector (itab);
+    LOG ("reset signature lists");
+  }
+}
+
+// Push 'c' on the occurrence list of 'lit' and its signature 'sig' on the
+// corresponding signature list if signatures are used.
+
+void Internal::push_occs (int lit, Clause * c, uint64_t sig) {
+  occs (lit).push_back (c);
+  if (signing ()) sigs (lit).push_back (sig);
 }
 
 /*------------------------------------------------------------------------*/
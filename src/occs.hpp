@@ -27,6 +27,39 @@ inline void remove_occs (Occs & os, Clause * c) {
   os.resize (i - os.begin ());
 }
 
+// Clause signatures kept in side arrays parallel to occurrence lists.  The
+// signature of a clause has the bit 'signature_bit (idx)' set for each
+// variable 'idx' in the clause.  Thus if the signature of 'C' has a bit
+// set, which is not set in the signature of 'D', then 'C' contains a
+// variable not in 'D' and can neither subsume nor strengthen 'D'.  Since
+// we also want to use it for strengthening, we have to hash variables
+// and not literals.
+
+typedef vector<uint64_t> Sigs;
+
+inline uint64_t signature_bit (int lit) {
+  const unsigned idx = abs (lit);
+  return (uint64_t) 1 << ((idx * 2654435761u) >> 26);
+}
+
+// Signature of a recently learned clause used in eager subsumption.
+
+struct Signed {
+  Clause * clause;
+  uint64_t sig;
+  Signed (Clause * c, uint64_t s) : clause (c), sig (s) { }
+};
+
+// Remove 'c' from 'os' and the corresponding entry from the side array.
+
+inline void remove_occs (Occs & os, Sigs & ss, Clause * c) {
+  assert (os.size () == ss.size ());
+  const auto i = find (os.begin (), os.end (), c);
+  assert (i != os.end ());
+  ss.erase (ss.begin () + (i - os.begin ()));
+  os.erase (i);
+}
+
 typedef Occs::iterator occs_iterator;
 typedef Occs::const_iterator const_occs_iterator;
 
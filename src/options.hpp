@@ -21,8 +21,12 @@
 \
 OPTION( arena,             1,  0,  1, 0, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1, 0, "keep clauses compact") \
+OPTION( arenaparallel,     1,  0,  1, 0, "parallel copying collector") \
 OPTION( arenasort,         1,  0,  1, 0, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3, 0, "1=clause, 2=var, 3=queue") \
+OPTION( autarky,           1,  0,  1, 0, "autarky detection and removal") \
+OPTION( autarkywitlim,   1e6,  0,2e9, 1, "maximum autarky witness size") \
+OPTION( backbonechunk,   1e2,  1,1e5, 0, "maximum backbone chunk size") \
 OPTION( binary,            1,  0,  1, 0, "use binary proof format") \
 OPTION( block,             0,  0,  1, 0, "blocked clause elimination") \
 OPTION( blockmaxclslim,  1e5,  1,2e9, 2, "maximum clause size") \
@@ -31,6 +35,11 @@ OPTION( blockocclim,     1e2,  1,2e9, 2, "occurrence limit") \
 OPTION( bump,              1,  0,  1, 0, "bump variables") \
 OPTION( bumpreason,        1,  0,  1, 0, "bump reason literals too") \
 OPTION( bumpreasondepth,   1,  1,  3, 0, "bump reason depth") \
+OPTION( bva,               0,  0,  1, 0, "bounded variable addition") \
+OPTION( bvamaxeff,       1e7,  0,2e9, 1, "maximum addition efficiency") \
+OPTION( card,              0,  0,  1, 0, "native at-most-one constraints") \
+OPTION( cardmaxeff,      1e7,  0,2e9, 1, "maximum detection efficiency") \
+OPTION( cardminsize,       6,  3,2e9, 1, "minimum constraint size") \
 OPTION( check,             0,  0,  1, 0, "enable internal checking") \
 OPTION( checkassumptions,  1,  0,  1, 0, "check assumptions satisfied") \
 OPTION( checkfailed,       1,  0,  1, 0, "check failed literals form core") \
@@ -45,12 +54,16 @@ OPTION( compact,           1,  0,  1, 0, "compact internal variables") \
 OPTION( compactint,      2e3,  1,2e9, 0, "compacting interval") \
 OPTION( compactlim,      1e2,  0,1e3, 0, "inactive limit in per mille") \
 OPTION( compactmin,      1e2,  1,2e9, 0, "minimum inactive limit") \
+OPTION( compactorder,      0,  0,  2, 0, "renumber 1=queue, 2=bfs") \
 OPTION( condition,         0,  0,  1, 0, "globally blocked clause elim") \
 OPTION( conditionint,    1e4,  1,2e9, 0, "initial conflict interval") \
 OPTION( conditionmaxeff, 1e7,  0,2e9, 1, "maximum condition efficiency") \
 OPTION( conditionmaxratio,100, 1,2e9, 1, "maximum clause variable ratio") \
 OPTION( conditionmineff, 1e6,  0,2e9, 1, "minimum condition efficiency") \
 OPTION( conditionreleff, 100,  1,1e5, 0, "relative efficiency in per mille") \
+OPTION( congruence,        1,  0,  1, 0, "congruence closure on gates") \
+OPTION( congruencearity,  20,  2,1e4, 1, "maximum AND gate arity") \
+OPTION( congruencemaxeff,1e7,  0,2e9, 1, "maximum gate extraction efficiency") \
 OPTION( cover,             0,  0,  1, 0, "covered clause elimination") \
 OPTION( covermaxclslim,  1e5,  1,2e9, 2, "maximum clause size") \
 OPTION( covermaxeff,     1e8,  0,2e9, 1, "maximum cover efficiency") \
@@ -60,6 +73,7 @@ OPTION( coverreleff,       4,  1,1e5, 1, "relative efficiency per mille") \
 OPTION( decompose,         1,  0,  1, 0, "decompose BIG in SCCs and ELS") \
 OPTION( decomposerounds,   2,  1, 16, 1, "number of decompose rounds") \
 OPTION( deduplicate,       1,  0,  1, 0, "remove duplicated binary clauses") \
+OPTION( deduplicateall,    1,  0,  1, 0, "remove duplicated clauses of all sizes") \
 OPTION( eagersubsume,      1,  0,  1, 0, "subsume eagerly recently learned") \
 OPTION( eagersubsumelim,  20,  1,1e3, 0, "limit on subsumed candidates") \
 OPTION( elim,              1,  0,  1, 0, "bounded variable elimination") \
@@ -69,12 +83,16 @@ OPTION( elimbackward,      1,  0,  1, 0, "eager backward subsumption") \
 OPTION( elimboundmax,     16, -1,2e6, 1, "maximum elimination bound") \
 OPTION( elimboundmin,      0, -1,2e6, 0, "minimum elimination bound") \
 OPTION( elimclslim,      1e2,  2,2e9, 2, "resolvent size limit") \
+OPTION( elimdefocclim,    32,  2,1e4, 1, "definition mining occurrence limit") \
+OPTION( elimdefs,          1,  0,  1, 0, "find definitions semantically") \
+OPTION( elimdefticks,    1e4,  0,2e9, 1, "definition mining effort") \
 OPTION( elimequivs,        1,  0,  1, 0, "find equivalence gates") \
 OPTION( elimineff,       1e7,  0,2e9, 1, "minimum elimination efficiency") \
 OPTION( elimint,         2e3,  1,2e9, 0, "elimination interval") \
 OPTION( elimites,          1,  0,  1, 0, "find if-then-else gates") \
 OPTION( elimlimited,       1,  0,  1, 0, "limit resolutions") \
 OPTION( elimocclim,      1e3,  0,2e9, 2, "occurrence limit") \
+OPTION( elimparallel,      1,  0,  1, 0, "parallel elimination batches") \
 OPTION( elimprod,          1,  0,1e4, 0, "elimination score product") \
 OPTION( elimreleff,      1e3,  1,1e5, 1, "relative efficiency per mille") \
 OPTION( elimrounds,        2,  1,512, 1, "usual number of rounds") \
@@ -92,6 +110,11 @@ OPTION( flush,             0,  0,  1, 0, "flush redundant clauses") \
 OPTION( flushfactor,       3,  1,1e3, 0, "interval increase") \
 OPTION( flushint,        1e5,  1,2e9, 0, "initial limit") \
 OPTION( forcephase,        0,  0,  1, 0, "always use initial phase") \
+OPTION( gauss,             1,  0,  1, 0, "root level Gauss on XORs") \
+OPTION( gaussmaxeff,     1e7,  0,2e9, 1, "maximum Gauss efficiency") \
+OPTION( gaussprooflim,     8,  2, 16, 1, "maximum rows union in proofs") \
+OPTION( gaussxorlim,       5,  3, 10, 1, "maximum XOR size") \
+OPTION( hugepages,         1,  0,  1, 0, "use transparent huge pages") \
 OPTION( inprocessing,      1,  0,  1, 0, "enable inprocessing") \
 OPTION( instantiate,       0,  0,  1, 0, "variable instantiation") \
 OPTION( instantiateclslim, 3,  2,2e9, 0, "minimum clause size") \
@@ -108,8 +131,10 @@ OPTION( probehbr,          1,  0,  1, 0, "learn hyper binary clauses") \
 OPTION( probeint,        5e3,  1,2e9, 0, "probing interval" ) \
 OPTION( probemaxeff,     1e8,  0,2e9, 1, "maximum probing efficiency") \
 OPTION( probemineff,     1e6,  0,2e9, 1, "minimum probing efficiency") \
+OPTION( probeparallel,     1,  0,  1, 0, "parallel failed literal probing") \
 OPTION( probereleff,      20,  1,1e5, 1, "relative efficiency per mille") \
 OPTION( proberounds,       1,  1, 16, 1, "probing rounds" ) \
+OPTION( probetree,         1,  0,  1, 0, "tree-based look-ahead probing") \
 OPTION( profile,           2,  0,  4, 0, "profiling level") \
 QUTOPT( quiet,             0,  0,  1, 0, "disable all messages") \
 OPTION( radixsortlim,    800,  0,2e9, 0, "radix sort limit") \
@@ -133,6 +158,9 @@ OPTION( restartreusetrail, 1,  0,  1, 0, "enable trail reuse") \
 OPTION( restoreall,        0,  0,  2, 0, "restore all clauses (2=really)") \
 OPTION( restoreflush,      0,  0,  1, 0, "remove satisfied clauses") \
 OPTION( reverse,           0,  0,  1, 0, "reverse variable ordering") \
+OPTION( schedule,          1,  0,  1, 0, "payoff driven inprocessing") \
+OPTION( schedulefruitless, 3,  1,100, 0, "fruitless calls before delay") \
+OPTION( schedulescale,     4,  1,100, 0, "maximum effort scaling factor") \
 OPTION( score,             1,  0,  1, 0, "use EVSIDS scores") \
 OPTION( scorefactor,     950,500,1e3, 0, "score factor per mille") \
 OPTION( seed,              0,  0,2e9, 0, "random seed") \
@@ -140,7 +168,9 @@ OPTION( shuffle,           0,  0,  1, 0, "shuffle variables") \
 OPTION( shufflequeue,      1,  0,  1, 0, "shuffle variable queue") \
 OPTION( shufflerandom,     0,  0,  1, 0, "not reverse but random") \
 OPTION( shufflescores,     1,  0,  1, 0, "shuffle variable scores") \
+OPTION( signatures,        1,  0,  1, 0, "clause signature filtering") \
 OPTION( simplify,          1,  0,  1, 0, "enable simplifier") \
+OPTION( sparse,            0,  0,  1, 0, "sparse external variables") \
 OPTION( stabilize,         1,  0,  1, 0, "enable stabilizing phases") \
 OPTION( stabilizefactor, 200,101,2e9, 0, "phase increase in percent") \
 OPTION( stabilizeint,    1e3,  1,2e9, 0, "stabilizing interval") \
@@ -155,8 +185,17 @@ OPTION( subsumelimited,    1,  0,  1, 0, "limit subsumption checks") \
 OPTION( subsumemaxeff,   1e8,  0,2e9, 1, "maximum subsuming efficiency") \
 OPTION( subsumemineff,   1e6,  0,2e9, 1, "minimum subsuming efficiency") \
 OPTION( subsumeocclim,   1e2,  0,2e9, 1, "watch list length limit") \
+OPTION( subsumeparallel,   1,  0,  1, 0, "parallel subsumption segments") \
 OPTION( subsumereleff,   1e3,  1,1e5, 1, "relative efficiency per mille") \
 OPTION( subsumestr,        1,  0,  1, 0, "strengthen during subsume") \
+OPTION( sweep,             1,  0,  1, 0, "SAT sweeping for equivalences") \
+OPTION( sweepconflicts,  1e2,  0,1e4, 1, "conflicts per sub-solver call") \
+OPTION( sweepdepth,        2,  0, 10, 1, "environment depth") \
+OPTION( sweepmaxclauses, 1e3,  1,1e5, 1, "maximum environment clauses") \
+OPTION( sweepmaxeff,     1e7,  0,2e9, 1, "maximum sweeping efficiency") \
+OPTION( sweepmaxvars,    128,  2,1e4, 1, "maximum environment variables") \
+OPTION( sweepmineff,     1e5,  0,2e9, 1, "minimum sweeping efficiency") \
+OPTION( sweepreleff,      10,  1,1e5, 1, "relative efficiency per mille") \
 OPTION( ternary,           1,  0,  1, 0, "hyper ternary resolution") \
 OPTION( ternarymaxadd,   1e3,  0,1e4, 1, "maximum clauses added in percent") \
 OPTION( ternarymaxeff,   1e8,  0,2e9, 1, "ternary maximum efficiency") \
@@ -164,17 +203,26 @@ OPTION( ternarymineff,   1e6,  1,2e9, 1, "minimum ternary efficiency") \
 OPTION( ternaryocclim,   1e2,  1,2e9, 2, "ternary occurrence limit") \
 OPTION( ternaryreleff,    10,  1,1e5, 1, "relative efficiency in per mille") \
 OPTION( ternaryrounds,     2,  1, 16, 1, "maximum ternary rounds") \
+OPTION( threads,           1,  1, 64, 0, "worker threads of parallel phases") \
+OPTION( threadschunk,    100,  1,2e9, 0, "minimum work items per thread") \
 OPTION( transred,          1,  0,  1, 0, "transitive reduction of BIG") \
 OPTION( transredmaxeff,  1e8,  0,2e9, 1, "maximum efficiency") \
 OPTION( transredmineff,  1e6,  0,2e9, 1, "minimum efficiency") \
 OPTION( transredreleff,  1e2,  1,1e5, 1, "relative efficiency per mille") \
+OPTION( unhide,            1,  0,  1, 0, "unhide redundancies in BIG") \
+OPTION( unhidemaxeff,    1e8,  0,2e9, 1, "maximum efficiency") \
+OPTION( unhidemineff,    1e6,  0,2e9, 1, "minimum efficiency") \
+OPTION( unhidereleff,    1e2,  1,1e5, 1, "relative efficiency per mille") \
+OPTION( unhiderounds,      3,  1,100, 1, "maximum unhiding rounds") \
 QUTOPT( verbose,           0,  0,  3, 0, "more verbose messages") \
 OPTION( vivify,            1,  0,  1, 0, "vivification") \
 OPTION( vivifymaxeff,    1e8,  0,2e9, 1, "maximum efficiency") \
 OPTION( vivifymineff,    1e5,  0,2e9, 1, "minimum efficiency") \
 OPTION( vivifyonce,        0,  0,  2, 0, "vivify once: 1=red, 2=red+irr") \
+OPTION( vivifyparallel,    1,  0,  1, 0, "parallel vivification segments") \
 OPTION( vivifyredeff,    300,  0,1e3, 1, "redundant efficiency per mille") \
 OPTION( vivifyreleff,     80,  1,1e5, 1, "relative efficiency per mille") \
+OPTION( vivifytrie,      1e3,  0,1e6, 1, "prefix trie batch size (0=off)") \
 OPTION( walk,              1,  0,  1, 0, "enable random walks") \
 OPTION( walkmaxeff,      1e7,  0,2e9, 1, "maximum efficiency") \
 OPTION( walkmineff,      1e5,  0,1e7, 1, "minimum efficiency") \
@@ -0,0 +1,114 @@
+#include "internal.hpp"
+
+/*------------------------------------------------------------------------*/
+
+// Memory mapping and transparent huge pages are Linux specific.  On other
+// systems 'MADV_HUGEPAGE' is not defined and we just use 'new' and
+// 'delete' (and thus the 'hugepages' option becomes ineffective).
+
+extern "C" {
+#include <sys/mman.h>
+}
+
+#if defined(MADV_HUGEPAGE) && defined(MAP_ANONYMOUS)
+#define HUGEPAGES
+#endif
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Allocate a region of at least 'bytes' bytes.  If huge pages are enabled
+// and the region is large enough we map a slightly larger region, cut off
+// its unaligned head and tail and advise the kernel to back the remaining
+// huge page aligned part with huge pages.  Mapped regions read as zero and
+// their pages are only allocated on first touch.  The fallback with 'new'
+// does not initialize the region on purpose, since zeroing it would touch
+// every page up front.  Callers which need zero bytes have to clear
+// unmapped regions themselves.
+
+char * Internal::new_pages (size_t bytes, size_t & mapped) {
+  mapped = 0;
+#ifdef HUGEPAGES
+  if (opts.hugepages && bytes >= huge_page_size) {
+    const size_t aligned = align_to_huge_page_size (bytes);
+    const size_t requested = aligned + huge_page_size;
+    void * p = mmap (0, requested, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p != MAP_FAILED) {
+      char * start = (char *) p;
+      uintptr_t tmp = (uintptr_t) start + huge_page_size - 1;
+      tmp &= ~(uintptr_t) (huge_page_size - 1);
+      char * res = (char *) tmp;
+      const size_t head = res - start;
+      const size_t tail = requested - head - aligned;
+      if (head) munmap (start, head);
+      if (tail) munmap (res + aligned, tail);
+      stats.hugepages.regions++;
+      stats.hugepages.mapped += aligned;
+      if (madvise (res, aligned, MADV_HUGEPAGE))
+        LOG ("advising huge pages for %zd mapped bytes failed", aligned);
+      else stats.hugepages.advised += aligned;
+      LOG ("mapped %zd bytes at %p for %zd requested bytes",
+        aligned, res, bytes);
+      mapped = aligned;
+      return res;
+    }
+    LOG ("mapping %zd bytes failed (falling back to 'new')", requested);
+  }
+#endif
+  return new char [bytes];
+}
+
+// Give back physical memory of a mapped region to the kernel but keep the
+// virtual address range, such that it can be reused without new mapping.
+
+void Internal::release_pages (char * p, size_t mapped) {
+  if (!mapped) return;
+#ifdef HUGEPAGES
+  if (madvise (p, mapped, MADV_DONTNEED))
+    LOG ("releasing %zd mapped bytes at %p failed", mapped, p);
+  else {
+    LOG ("released %zd mapped bytes at %p", mapped, p);
+    stats.hugepages.released += mapped;
+  }
+#else
+  (void) p;
+#endif
+}
+
+void Internal::delete_pages (char * p, size_t mapped) {
+#ifdef HUGEPAGES
+  if (mapped) { munmap (p, mapped); return; }
+#else
+  assert (!mapped);
+  (void) mapped;
+#endif
+  delete [] p;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Variable tables such as 'vtab' and 'wtab' are vectors and thus not
+// allocated through 'new_pages'.  For large tables we still advise the
+// kernel to use huge pages for the huge page aligned part of their data.
+
+void Internal::advise_huge_pages (const void * p, size_t bytes) {
+#ifdef HUGEPAGES
+  if (!opts.hugepages) return;
+  if (bytes < 2*huge_page_size) return;
+  uintptr_t start = (uintptr_t) p + huge_page_size - 1;
+  start &= ~(uintptr_t) (huge_page_size - 1);
+  uintptr_t end = (uintptr_t) p + bytes;
+  end &= ~(uintptr_t) (huge_page_size - 1);
+  if (start >= end) return;
+  const size_t aligned = end - start;
+  if (madvise ((void *) start, aligned, MADV_HUGEPAGE)) return;
+  LOG ("advised huge pages for %zd of %zd table bytes", aligned, bytes);
+  stats.hugepages.advised += aligned;
+#else
+  (void) p, (void) bytes;
+#endif
+}
+
+}
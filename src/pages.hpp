@@ -0,0 +1,35 @@
+#ifndef _pages_hpp_INCLUDED
+#define _pages_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Large memory regions, i.e., the semi-spaces of the clause 'Arena' and
+// the assignment array 'vals', are allocated through 'Internal::new_pages'
+// in 'pages.cpp'.  If the option 'hugepages' is enabled and the region is
+// at least as large as a huge page, then the region is memory mapped,
+// aligned to the huge page size and marked with 'madvise (MADV_HUGEPAGE)'
+// as candidate for transparent huge pages on Linux.  This reduces TLB
+// misses when accessing clauses and values randomly during propagation.
+// Otherwise (or if memory mapping fails) we fall back to 'new'.
+
+// The caller has to remember the 'mapped' size returned by 'new_pages'
+// and pass it back to 'release_pages' and 'delete_pages'.  A zero 'mapped'
+// size means that the region was allocated with 'new'.  Released mapped
+// regions keep their virtual address range but the kernel drops their
+// physical pages ('MADV_DONTNEED'), which then read as zero if reused.
+
+// These functions update statistics and log messages and thus are not
+// thread-safe.  They are only called by the main solver thread, i.e.,
+// never from the work functions of parallel phases (see 'parallel.hpp').
+// The parallel copying collector only writes into the 'to' space after it
+// was allocated by 'Arena::prepare'.
+
+static const size_t huge_page_size = (size_t) 1 << 21;   // 2 MB
+
+inline size_t align_to_huge_page_size (size_t bytes) {
+  return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+}
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "internal.hpp"
+
+#ifndef NTHREADS
+#include <thread>
+#endif
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+static size_t chunk_begin (unsigned worker, unsigned workers, size_t size) {
+  return (size * worker) / workers;
+}
+
+void parallel_for (unsigned workers, size_t size, const Work & work) {
+  assert (workers > 0);
+  if (workers > size) workers = size ? size : 1;
+#ifndef NTHREADS
+  vector<std::thread> threads;
+  unsigned worker;
+  for (worker = 1; worker < workers; worker++) {
+    const size_t begin = chunk_begin (worker, workers, size);
+    const size_t end = chunk_begin (worker + 1, workers, size);
+    try {
+      threads.push_back (std::thread (work, worker, begin, end));
+    } catch (...) {
+      break;                    // Process remaining chunks sequentially.
+    }
+  }
+  work (0, 0, chunk_begin (1, workers, size));
+  for (unsigned i = worker; i < workers; i++)
+    work (i, chunk_begin (i, workers, size),
+             chunk_begin (i + 1, workers, size));
+  for (auto & thread : threads)
+    thread.join ();
+#else
+  for (unsigned i = 0; i < workers; i++)
+    work (i, chunk_begin (i, workers, size),
+             chunk_begin (i + 1, workers, size));
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
+// Number of workers used for a parallel phase working on 'size' elements.
+// This is one if the 'threads' option is not larger than one or if the
+// library is compiled without thread support.  Each worker gets at least
+// 'threadschunk' elements, since otherwise starting and joining threads
+// costs more than the work itself.  Thus small ranges are processed by the
+// calling thread only.
+
+unsigned Internal::parallel_workers (size_t size) {
+#ifdef NTHREADS
+  (void) size;
+  return 1;
+#else
+  size_t res = opts.threads;
+  const size_t chunks = size / opts.threadschunk;
+  if (res > chunks) res = chunks;
+  if (!res) res = 1;
+  return res;
+#endif
+}
+
+}
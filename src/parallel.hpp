@@ -0,0 +1,32 @@
+#ifndef _parallel_hpp_INCLUDED
+#define _parallel_hpp_INCLUDED
+
+#include <functional>
+
+namespace CaDiCaL {
+
+// Simple fork-join parallelism for parallel phases, which are enabled by
+// setting the option 'threads' to a value larger than one.  The index
+// range '[0,size)' is split into 'workers' consecutive chunks of (almost)
+// the same size.  The first chunk is processed by the calling thread and
+// every other chunk by its own new thread, which are all joined before
+// returning.  The partition only depends on 'size' and 'workers', so two
+// calls with the same arguments hand out the same chunks to the same
+// worker index.  This is needed to keep parallel phases deterministic.
+//
+// The work function gets the worker index and the chunk '[begin,end)'.  It
+// is only allowed to modify data which is either local to the worker or
+// partitioned by the chunk and must not call functions which update
+// statistics, proof observers or produce log messages.
+
+// If the library is compiled without thread support ('-DNTHREADS') all
+// chunks are processed sequentially by the calling thread.
+
+typedef std::function<void (unsigned worker, size_t begin, size_t end)>
+  Work;
+
+void parallel_for (unsigned workers, size_t size, const Work &);
+
+}
+
+#endif
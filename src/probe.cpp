@@ -10,6 +10,16 @@ namespace CaDiCaL {
 // search for failed literals is limited, but untried roots are kept until
 // the next time 'probe' is called.  Left over probes from the last attempt
 // and new probes are tried until the limit is hit or all are tried.
+//
+// With tree-based look-ahead (option 'probetree') probes are not always
+// assigned on decision level one.  Probes and the literals they imply are
+// organized in a forest, where the parent of a node is implied by the node
+// through a binary clause.  Nodes are probed in depth first order with the
+// decisions of all ancestors kept on the trail.  Each decision level thus
+// only propagates what the node implies beyond its parent.  All literals
+// assigned on the current decision level are still implied by its
+// decision, which together with the decisions of lower levels (each
+// implied by the next one) forms a tree rooted at the current decision.
 
 /*------------------------------------------------------------------------*/
 
@@ -28,22 +38,34 @@ bool Internal::probing () {
 // On-the-fly (dynamic) hyper binary resolution on decision level one can
 // make use of the fact that the implication graph is actually a tree.
 
-// Compute a dominator of two literals in the binary implication tree.
+// Compute a dominator of two literals in the binary implication tree.  On
+// lower decision levels during tree-based look-ahead the parent of a
+// decision is the decision of the next level, which implies it.  Thus
+// literals on higher levels are closer to the root of the tree.
 
 int Internal::probe_dominator (int a, int b) {
   require_mode (PROBE);
   int l = a, k = b;
   Var * u = &var (l), * v = &var (k);
   assert (val (l) > 0), assert (val (k) > 0);
-  assert (u->level == 1), assert (v->level == 1);
+  assert (u->level), assert (v->level);
+  assert (u->level <= level), assert (v->level <= level);
   while (l != k) {
-    if (u->trail > v->trail) swap (l, k), swap (u, v);
-    if (!u->parent) return l;
-    int parent = v->parent;
-    if (k < 0) parent = -parent;
+    if (u->level < v->level ||
+        (u->level == v->level && u->trail > v->trail))
+      swap (l, k), swap (u, v);
+    if (!u->parent && u->level == level) return l;
+    int parent;
+    if (v->parent) {
+      parent = v->parent;
+      if (k < 0) parent = -parent;
+    } else {
+      assert (v->level < level);
+      parent = control[v->level + 1].decision;
+    }
     assert  (parent), assert (val (parent) > 0);
     v = &var (k = parent);
-    assert (v->level == 1);
+    assert (v->level), assert (v->level <= level);
   }
   LOG ("dominator %d of %d and %d", l, a, b);
   assert (val (l) > 0);
@@ -99,7 +121,7 @@ int Internal::probe_dominator (int a, int b) {
 
 inline int Internal::hyper_binary_resolve (Clause * reason) {
   require_mode (PROBE);
-  assert (level == 1);
+  assert (level > 0);
   assert (reason->size > 2);
   const const_literal_iterator end = reason->end ();
   const int * lits = reason->literals;
@@ -108,7 +130,7 @@ inline int Internal::hyper_binary_resolve (Clause * reason) {
   // First literal unassigned, all others false.
   assert (!val (lits[0]));
   for (k = lits + 1; k != end; k++) assert (val (*k) < 0);
-  assert (var (lits[1]).level == 1);
+  assert (var (lits[1]).level == level);
 #endif
   LOG (reason, "hyper binary resolving");
   stats.hbrs++;
@@ -167,7 +189,6 @@ inline void Internal::probe_assign (int lit, int parent) {
   const signed char tmp = sign (lit);
   v.parent = tmp < 0 ? -parent : parent;
   if (!level) learn_unit_clause (lit);
-  else assert (level == 1);
   vals[idx] = tmp;
   vals[-idx] = -tmp;
   assert (val (lit) > 0);
@@ -188,7 +209,6 @@ inline void Internal::probe_assign (int lit, int parent) {
 
 void Internal::probe_assign_decision (int lit) {
   require_mode (PROBE);
-  assert (!level);
   assert (propagated == trail.size ());
   level++;
   control.push_back (Level (lit, trail.size ()));
@@ -276,7 +296,7 @@ bool Internal::probe_propagate () {
             watch_literal (r, lit, w.clause);
             j--;
           } else if (!u) {
-            if (level == 1) {
+            if (level) {
               int dom = hyper_binary_resolve (w.clause);
               probe_assign (other, dom);
             } else probe_assign_unit (other);
@@ -310,7 +330,7 @@ void Internal::failed_literal (int failed) {
 
   assert (!unsat);
   assert (conflict);
-  assert (level == 1);
+  assert (level > 0);
   assert (analyzed.empty ());
 
   START (analyze);
@@ -529,6 +549,543 @@ int Internal::next_probe () {
   }
 }
 
+// Fill 'segment' with up to 'max' probes.  The schedule is not generated
+// again once the segment is not empty, since otherwise the probes already
+// in the segment would be scheduled again.
+
+void Internal::next_probes (vector<int> & segment, size_t max) {
+  while (segment.size () < max) {
+    if (!segment.empty () && probes.empty ()) break;
+    const int probe = next_probe ();
+    if (!probe) break;
+    segment.push_back (probe);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Parallel failed literal probing.  Probes are taken from the schedule in
+// segments and split into tasks handed to worker threads.  Each worker
+// has its own assignment, parents and trail on top of the root level
+// assignment and propagates over a shared read-only snapshot of the
+// binary implication graph (binary clauses first as in 'probe_propagate')
+// and its own watches of the large clauses.  A worker probes both phases
+// of a probe and reports failed phases, the literals implied by both
+// phases and hyper binary resolvents.  All of them are then learned in
+// the main thread in the order of the segment with proofs.  Failed
+// literals are simply probed again sequentially, which also takes care of
+// analyzing the conflict.  Units implied by both phases 'probe' and
+// '-probe' are derived through the two temporary lemmas '-probe unit' and
+// 'probe unit', which both are RUP.  Since root level units and binary
+// clauses only get added during probing, everything found by the workers
+// remains valid while the results are applied.
+
+struct ProbeWatch {
+  Clause * clause;
+  int blit;
+  unsigned idx;                         // of watched literals in worker
+};
+
+struct ProbeHBR {
+  int dom, lit;                         // resolvent '-dom lit'
+  Clause * reason;                      // resolved large clause
+  bool contained;                       // resolvent subsumes reason
+};
+
+struct ProbeResult {
+  int failed;                           // failed phase (or zero)
+  vector<int> implied;                  // by non-failed phases
+  vector<int> units;                    // implied by both phases
+  vector<ProbeHBR> hbrs;
+  ProbeResult () : failed (0) { }
+};
+
+struct ProbeWorker {
+
+  static const size_t task = 16;        // probes per task
+
+  Internal * internal;
+  const BinGraph * graph;
+  bool initialized;
+
+  vector<signed char> vals;             // private assignment by 'vlit'
+  vector<signed char> marks;            // implied by first phase
+  vector<int> parents;                  // by variable index
+  vector<int> positions;                // trail position by index
+  vector<int> trail;
+  size_t propagated, propagated2;
+
+  vector<vector<ProbeWatch>> watches;   // by 'vlit'
+  vector<int> watched;                  // two literals per clause
+
+  int64_t propagations;
+
+  ProbeWorker (Internal * i, const BinGraph * g) :
+    internal (i), graph (g), initialized (false),
+    propagated (0), propagated2 (0), propagations (0)
+  { }
+
+  unsigned vlit (int lit) const { return internal->vlit (lit); }
+
+  signed char val (int lit) const {
+    const signed char res = internal->val (lit);    // root level
+    return res ? res : vals[vlit (lit)];
+  }
+
+  void init (const vector<Clause *> & snapshot);
+  void assign (int lit, int parent);
+  void backtrack ();
+  int dominator (int a, int b) const;
+  int hyper_binary_resolve (Clause *, int unit, ProbeResult &);
+  bool propagate (ProbeResult &);
+  bool phase (int lit, ProbeResult &);
+  void probe (int lit, ProbeResult &);
+};
+
+void ProbeWorker::init (const vector<Clause *> & snapshot) {
+  assert (!initialized);
+  initialized = true;
+  const size_t vsize = internal->max_var + 1;
+  vals.resize (2*vsize, 0);
+  marks.resize (2*vsize, 0);
+  parents.resize (vsize, 0);
+  positions.resize (vsize, 0);
+  watches.resize (2*vsize);
+  watched.resize (2*snapshot.size (), 0);
+  for (size_t i = 0; i < snapshot.size (); i++) {
+    Clause * c = snapshot[i];
+    if (c->garbage) continue;
+    int lits[2], found = 0;
+    bool satisfied = false;
+    for (const auto & lit : *c) {
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0) { satisfied = true; break; }
+      if (tmp < 0) continue;
+      if (found < 2) lits[found++] = lit;
+    }
+    if (satisfied || found < 2) continue;
+    watched[2*i] = lits[0];
+    watched[2*i + 1] = lits[1];
+    watches[vlit (lits[0])].push_back ({ c, lits[1], (unsigned) i });
+    watches[vlit (lits[1])].push_back ({ c, lits[0], (unsigned) i });
+  }
+}
+
+inline void ProbeWorker::assign (int lit, int parent) {
+  const int idx = abs (lit);
+  assert (!val (lit));
+  vals[vlit (lit)] = 1;
+  vals[vlit (-lit)] = -1;
+  parents[idx] = parent;
+  positions[idx] = (int) trail.size ();
+  trail.push_back (lit);
+}
+
+void ProbeWorker::backtrack () {
+  for (const auto & lit : trail)
+    vals[vlit (lit)] = vals[vlit (-lit)] = 0;
+  trail.clear ();
+  propagated = propagated2 = 0;
+}
+
+// Same as 'probe_dominator' on the private parents and trail positions.
+
+int ProbeWorker::dominator (int a, int b) const {
+  while (a != b) {
+    if (positions[abs (a)] > positions[abs (b)]) swap (a, b);
+    if (!parents[abs (a)]) return a;
+    b = parents[abs (b)];
+    assert (b);
+  }
+  return a;
+}
+
+// Same as 'hyper_binary_resolve' except that the resolvent is only
+// recorded.  The reason is forcing 'unit' with all other literals false.
+
+int ProbeWorker::hyper_binary_resolve (Clause * c, int unit,
+                                       ProbeResult & res) {
+  int dom = 0, non_root_level_literals = 0;
+  for (const auto & lit : *c) {
+    if (lit == unit) continue;
+    assert (val (lit) < 0);
+    if (internal->val (lit)) continue;
+    dom = dom ? dominator (dom, -lit) : -lit;
+    non_root_level_literals++;
+  }
+  assert (dom);
+  if (non_root_level_literals > 1 && internal->opts.probehbr) {
+    bool contained = false;
+    for (const auto & lit : *c)
+      if (lit == -dom) { contained = true; break; }
+    res.hbrs.push_back ({ dom, unit, c, contained });
+  }
+  return dom;
+}
+
+// Same as 'probe_propagate' but without adding hyper binary resolvents
+// and with the binary clauses taken from the implication graph snapshot.
+
+bool ProbeWorker::propagate (ProbeResult & res) {
+  bool conflict = false;
+  while (!conflict) {
+    if (propagated2 < trail.size ()) {
+      const int lit = trail[propagated2++];
+      propagations++;
+      const Bin * const eob = graph->end (vlit (lit));
+      for (const Bin * k = graph->begin (vlit (lit));
+           !conflict && k != eob; k++) {
+        const signed char tmp = val (k->lit);
+        if (tmp < 0) conflict = true;
+        else if (!tmp) assign (k->lit, lit);
+      }
+    } else if (propagated < trail.size ()) {
+      const int lit = -trail[propagated++];
+      auto & ws = watches[vlit (lit)];
+      const auto eow = ws.end ();
+      auto i = ws.begin (), j = i;
+      while (i != eow) {
+        const ProbeWatch w = *j++ = *i++;
+        if (val (w.blit) > 0) continue;
+        Clause * c = w.clause;
+        if (c->garbage) continue;
+        int * lits = &watched[2*w.idx];
+        const int other = lits[0] ^ lits[1] ^ lit;
+        const signed char u = val (other);
+        if (u > 0) { j[-1].blit = other; continue; }
+        int replacement = 0;
+        for (const auto & k : *c) {
+          if (k == lit || k == other) continue;
+          if (val (k) < 0) continue;
+          replacement = k;
+          break;
+        }
+        if (replacement) {
+          if (lits[0] == lit) lits[0] = replacement;
+          else lits[1] = replacement;
+          watches[vlit (replacement)].push_back ({ c, other, w.idx });
+          j--;
+        } else if (!u) assign (other, hyper_binary_resolve (c, other, res));
+        else { conflict = true; break; }
+      }
+      if (j != i) {
+        while (i != eow) *j++ = *i++;
+        ws.resize (j - ws.begin ());
+      }
+    } else break;
+  }
+  return !conflict;
+}
+
+// Propagate one phase of a probe.  Hyper binary resolvents of a failed
+// phase are dropped, since they are derived again when the failed literal
+// is probed sequentially.
+
+bool ProbeWorker::phase (int lit, ProbeResult & res) {
+  assert (trail.empty ());
+  const size_t hbrs = res.hbrs.size ();
+  assign (lit, 0);
+  if (propagate (res)) return true;
+  res.hbrs.resize (hbrs);
+  res.failed = lit;
+  return false;
+}
+
+void ProbeWorker::probe (int lit, ProbeResult & res) {
+  if (!phase (lit, res)) { backtrack (); return; }
+  for (const auto & other : trail) marks[vlit (other)] = 1;
+  res.implied = trail;
+  backtrack ();
+  if (phase (-lit, res)) {
+    for (const auto & other : trail)
+      if (marks[vlit (other)]) res.units.push_back (other);
+    res.implied.insert (res.implied.end (), trail.begin (), trail.end ());
+  }
+  backtrack ();
+  for (const auto & other : res.implied) marks[vlit (other)] = 0;
+}
+
+// Learn the results of a worker for 'probe' in the main thread.
+
+void Internal::probe_apply_result (int probe, ProbeResult & res,
+                                   int64_t fixed) {
+  assert (!level);
+  assert (propagated == trail.size ());
+
+  stats.probed++;
+
+  for (const auto & hbr : res.hbrs) {
+    if (unsat) break;
+    if (val (hbr.dom) || val (hbr.lit)) continue;
+    Clause * reason = hbr.reason;
+    stats.hbrs++;
+    stats.hbrsizes += reason->size;
+    const bool contained = hbr.contained && !reason->garbage;
+    const bool red = !contained || reason->redundant;
+    if (red) stats.hbreds++;
+    LOG ("new %s hyper binary resolvent %d %d",
+      (red ? "redundant" : "irredundant"), -hbr.dom, hbr.lit);
+    assert (clause.empty ());
+    clause.push_back (-hbr.dom);
+    clause.push_back (hbr.lit);
+    Clause * c = new_hyper_binary_resolved_clause (red, 2);
+    if (red) c->hyper = true;
+    clause.clear ();
+    if (contained) {
+      stats.hbrsubs++;
+      LOG (reason, "subsumed original");
+      mark_garbage (reason);
+    }
+  }
+
+  // Literals propagated without conflict are not probed again in this
+  // round unless new units are found (see 'next_probe').
+
+  for (const auto & lit : res.implied)
+    if (propfixed (lit) < fixed) propfixed (lit) = fixed;
+
+  const int failed = res.failed;
+  if (!unsat && failed && !val (failed)) {
+    LOG ("probing failed literal %d again", failed);
+    probe_assign_decision (failed);
+    if (probe_propagate ()) backtrack ();
+    else failed_literal (failed);
+  }
+
+  for (const auto & unit : res.units) {
+    if (unsat) break;
+    if (val (unit)) continue;
+    LOG ("unit %d implied by both phases of probe %d", unit, probe);
+    stats.probeunits++;
+    vector<int> first { -probe, unit }, second { probe, unit };
+    if (proof) {
+      proof->add_derived_clause (first);
+      proof->add_derived_clause (second);
+    }
+    probe_assign_unit (unit);
+    if (proof) {
+      proof->delete_clause (first);
+      proof->delete_clause (second);
+    }
+    if (!probe_propagate ()) learn_empty_clause ();
+  }
+}
+
+// Parallel version of the main loop of 'probe_round'.
+
+void Internal::probe_in_parallel (int64_t limit) {
+
+  BinGraph graph;
+  init_bin_graph (graph);
+
+  vector<Clause *> snapshot;
+  for (const auto & c : clauses)
+    if (!c->garbage && c->size > 2)
+      snapshot.push_back (c);
+
+  vector<ProbeWorker> workers;
+  vector<int> segment;
+  vector<ProbeResult> results;
+
+  const size_t task = ProbeWorker::task;
+  const size_t max_segment = 4 * task * opts.threads;
+
+  while (!unsat &&
+         !terminating () &&
+         stats.propagations.probe < limit) {
+
+    segment.clear ();
+    next_probes (segment, max_segment);
+    if (segment.empty ()) break;
+
+    const size_t size = segment.size ();
+    results.clear ();
+    results.resize (size);
+
+    const int64_t fixed = stats.all.fixed;
+    const size_t tasks = (size + task - 1) / task;
+    const unsigned count = parallel_workers (tasks);
+    while (workers.size () < count)
+      workers.push_back (ProbeWorker (this, &graph));
+
+    parallel_for (count, tasks,
+      [&] (unsigned worker, size_t begin, size_t end) {
+        ProbeWorker & w = workers[worker];
+        if (!w.initialized) w.init (snapshot);
+        const size_t last = min (size, end * task);
+        for (size_t i = begin * task; i < last; i++)
+          w.probe (segment[i], results[i]);
+      });
+
+    stats.probeparallel++;
+    for (auto & w : workers) {
+      stats.propagations.probe += w.propagations;
+      w.propagations = 0;
+    }
+
+    for (size_t i = 0; !unsat && i < size; i++)
+      probe_apply_result (segment[i], results[i], fixed);
+  }
+
+  graph.erase ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Tree-based look-ahead following our CPAIOR'13 paper.  The forest is
+// built from paths starting at each probe, which always continue with a
+// literal implied by the last node through a binary clause.  Literals
+// already in the forest are preferred as continuation and reaching such a
+// literal ends the path.  Then the trees are probed in depth first order
+// (see the discussion at the top of this file).  The nodes with decisions
+// on the trail are kept on 'path'.  After a failed literal all decisions
+// are gone and the ancestors of the next node are assumed again.
+
+struct ProbeNode {
+  int lit;                      // probed literal
+  int parent;                   // node implied by this one (or -1)
+  int child, sibling;           // first child and next sibling (or -1)
+  int path;                     // index of probe starting the path
+  int level;                    // decision level after probing it
+  bool visited;
+};
+
+// Make 'lit' true on the trail for tree-based look-ahead by deciding and
+// propagating it unless it is already implied by its ancestors.  If it is
+// implied false by its ancestors, which it implies, then it is a failed
+// literal and is probed again on its own.  Returns 'false' if 'lit' is
+// false afterwards.  Then all decisions are gone unless it was fixed.
+
+bool Internal::probe_tree_decide (int lit) {
+  const signed char tmp = val (lit);
+  if (tmp > 0) return true;
+  if (tmp < 0) {
+    if (!var (lit).level) return false;
+    LOG ("probe %d implied false by its ancestors", lit);
+    backtrack ();
+  }
+  stats.probed++;
+  probe_assign_decision (lit);
+  if (!probe_propagate ()) failed_literal (lit);
+  else if (!tmp) return true;
+  else backtrack ();
+  return false;
+}
+
+void Internal::probe_trees (int64_t limit) {
+
+  vector<int> segment, stack, ancestors, path;
+  vector<ProbeNode> nodes;
+  vector<int> index (2*(max_var + 1), 0);     // node plus one by 'vlit'
+
+  while (!unsat &&
+         !terminating () &&
+         stats.propagations.probe < limit) {
+
+    segment.clear ();
+    next_probes (segment, SIZE_MAX);
+    if (segment.empty ()) break;
+
+    for (size_t i = 0; i < segment.size (); i++) {
+      int lit = segment[i], prev = -1;
+      for (;;) {
+        int node = index[vlit (lit)] - 1;
+        const bool found = (node >= 0);
+        if (!found) {
+          node = nodes.size ();
+          nodes.push_back ({ lit, -1, -1, -1, (int) i, 0, false });
+          index[vlit (lit)] = node + 1;
+        }
+        if (prev >= 0) {
+          nodes[prev].parent = node;
+          nodes[prev].sibling = nodes[node].child;
+          nodes[node].child = prev;
+        }
+        if (found) break;
+        prev = node;
+        int next = 0;
+        for (const auto & w : watches (-lit)) {
+          if (!w.binary ()) continue;
+          if (w.clause->garbage) continue;
+          const int other = w.blit;
+          if (val (other)) continue;
+          const int other_node = index[vlit (other)] - 1;
+          if (other_node >= 0) {
+            if (nodes[other_node].path == (int) i) continue;
+            next = other;
+            break;
+          }
+          if (!next) next = other;
+        }
+        if (!next) break;
+        lit = next;
+      }
+    }
+
+    stats.probetrees++;
+    LOG ("probing forest of %zd nodes for %zd probes",
+      nodes.size (), segment.size ());
+
+    for (size_t root = 0; root < nodes.size (); root++) {
+      if (nodes[root].parent >= 0) continue;
+      stack.push_back (root);
+      while (!stack.empty ()) {
+        if (unsat) break;
+        if (terminating ()) break;
+        if (stats.propagations.probe >= limit) break;
+        const int node = stack.back ();
+        stack.pop_back ();
+        ProbeNode & n = nodes[node];
+        n.visited = true;
+        while (!path.empty () && path.back () != n.parent)
+          path.pop_back ();
+        if (path.empty () && n.parent >= 0) {
+          if (level) backtrack ();
+          assert (ancestors.empty ());
+          for (int a = n.parent; a >= 0; a = nodes[a].parent)
+            ancestors.push_back (a);
+          while (!ancestors.empty ()) {
+            const int a = ancestors.back ();
+            LOG ("probing ancestor %d again", nodes[a].lit);
+            if (!probe_tree_decide (nodes[a].lit)) break;
+            nodes[a].level = level;
+            path.push_back (a);
+            ancestors.pop_back ();
+          }
+          if (!ancestors.empty ()) {
+            if (!level) path.clear ();
+            ancestors.clear ();
+            continue;
+          }
+        } else backtrack (path.empty () ? 0 : nodes[path.back ()].level);
+        LOG ("probing %d on level %d", n.lit, level + 1);
+        if (!probe_tree_decide (n.lit)) {
+          if (!level) path.clear ();
+          continue;
+        }
+        n.level = level;
+        path.push_back (node);
+        for (int c = n.child; c >= 0; c = nodes[c].sibling)
+          stack.push_back (c);
+      }
+      stack.clear ();
+      path.clear ();
+      if (level) backtrack ();
+    }
+
+    // Put back probes not reached due to hitting the limit.
+
+    for (size_t i = segment.size (); i--; ) {
+      const int probe = segment[i];
+      if (!nodes[index[vlit (probe)] - 1].visited)
+        probes.push_back (probe);
+    }
+
+    for (const auto & n : nodes) index[vlit (n.lit)] = 0;
+    nodes.clear ();
+  }
+}
+
 bool Internal::probe_round () {
 
   if (unsat || terminating ()) return false;
@@ -544,6 +1101,7 @@ bool Internal::probe_round () {
   int64_t delta = stats.propagations.search;
   delta -= last.probe.propagations;
   delta *= 1e-3 * opts.probereleff;
+  delta *= schedule_effort (schedule.probe);
   if (delta < opts.probemineff) delta = opts.probemineff;
   if (delta > opts.probemaxeff) delta = opts.probemaxeff;
   delta += 2l * active ();
@@ -572,10 +1130,12 @@ bool Internal::probe_round () {
   propagated = propagated2 = trail.size ();
 
   int probe;
-  while (!unsat &&
-         !terminating () &&
-         stats.propagations.probe < limit &&
-         (probe = next_probe ())) { // 持續取出下一個要測試的 failed literal
+  if (opts.probeparallel && opts.threads > 1) probe_in_parallel (limit);
+  else if (opts.probetree) probe_trees (limit);
+  else while (!unsat &&
+              !terminating () &&
+              stats.propagations.probe < limit &&
+              (probe = next_probe ())) { // 持續取出下一個要測試的 failed literal
     stats.probed++;
     LOG ("probing %d", probe);
     probe_assign_decision (probe); // 假設這個 literal 是 true 看看
@@ -618,9 +1178,11 @@ void CaDiCaL::Internal::probe (bool update_limits) {
 
   if (unsat) return;
   if (level) backtrack ();
+  reset_cards ();
   if (!propagate ()) { learn_empty_clause (); return; }
 
   stats.probingphases++;
+  begin_recycling_occs ();
 
   // We trigger equivalent literal substitution (ELS) before ...
   //
@@ -629,6 +1191,21 @@ void CaDiCaL::Internal::probe (bool update_limits) {
   if (ternary ())       // If we derived a binary clause
     decompose ();       // then start another round of ELS.
 
+  if (gauss ())         // Same for equivalences from XORs.
+    decompose ();
+
+  if (congruence ())    // And from congruent gates.
+    decompose ();
+
+  if (sweep ())         // And equivalences found by sweeping.
+    decompose ();
+
+  // The effort of the simplifiers above is not part of 'schedule_cost', so
+  // probing is only measured from here on (including the decomposition at
+  // the end), just as the subsumption phase forced by 'elim'.
+  //
+  schedule_begin (schedule.probe);
+
   // Remove duplicated binary clauses and perform in essence hyper unary
   // resolution, i.e., derive the unit '2' from '1 2' and '-1 2'.
   //
@@ -641,10 +1218,13 @@ void CaDiCaL::Internal::probe (bool update_limits) {
   decompose ();         // ... and (ELS) afterwards.
 
   last.probe.propagations = stats.propagations.search;
+  end_recycling_occs ();
+  schedule_end (schedule.probe, "probe");
 
   if (!update_limits) return; // what does this line mean?
 
   int64_t delta = opts.probeint * (stats.probingphases + 1);
+  delta *= schedule_interval (schedule.probe);
   lim.probe = stats.conflicts + delta;
 
   PHASE ("probe-phase", stats.probingphases,
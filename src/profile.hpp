@@ -39,14 +39,18 @@ struct Internal;
 
 #define PROFILES \
 PROFILE(analyze,3) \
+PROFILE(autarky,2) \
 PROFILE(backward,3) \
 PROFILE(block,2) \
 PROFILE(bump,4) \
+PROFILE(bva,2) \
+PROFILE(card,3) \
 PROFILE(checking,2) \
 PROFILE(cdcl,1) \
 PROFILE(collect,3) \
 PROFILE(compact,3) \
 PROFILE(condition,2) \
+PROFILE(congruence,2) \
 PROFILE(connect,3) \
 PROFILE(copy,4) \
 PROFILE(cover,2) \
@@ -54,6 +58,7 @@ PROFILE(decide,3) \
 PROFILE(decompose,3) \
 PROFILE(elim,2) \
 PROFILE(extend,3) \
+PROFILE(gauss,2) \
 PROFILE(instantiate,2) \
 PROFILE(lucky,2) \
 PROFILE(minimize,4) \
@@ -70,8 +75,10 @@ PROFILE(stable,2) \
 PROFILE(preprocess,2) \
 PROFILE(simplify,1) \
 PROFILE(subsume,2) \
+PROFILE(sweep,2) \
 PROFILE(ternary,2) \
 PROFILE(transred,3) \
+PROFILE(unhide,3) \
 PROFILE(unstable,2) \
 PROFILE(vivify,2) \
 PROFILE(walk,2) \
@@ -55,6 +55,15 @@ Proof::Proof (Internal * s) : internal (s) { LOG ("PROOF new"); }
 
 Proof::~Proof () { LOG ("PROOF delete"); }
 
+// Only accounts for the proof object itself.  The connected checker and
+// tracer are accounted separately in 'Internal::memory_usage'.
+
+void Proof::memory_usage (Bytes & bytes) const {
+  bytes.add (sizeof *this, sizeof *this);
+  bytes.add (clause);
+  bytes.add (observers);
+}
+
 /*------------------------------------------------------------------------*/
 
 inline void Proof::add_literal (int internal_lit) {
@@ -6,6 +6,7 @@ namespace CaDiCaL {
 /*------------------------------------------------------------------------*/
 
 class File;
+struct Bytes;
 struct Clause;
 struct Internal;
 class Observer;
@@ -57,6 +58,8 @@ public:
   void strengthen_clause (Clause *, int); // remove second argument
 
   void flush ();
+
+  void memory_usage (Bytes &) const;    // Used and reserved bytes.
 };
 
 }
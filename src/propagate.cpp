@@ -123,6 +123,46 @@ void Internal::search_assign_driving (int lit, Clause * c) {
 
 /*------------------------------------------------------------------------*/
 
+// Propagate the native at-most-one constraints (see 'cardinality.cpp') of
+// the literal 'lit' which was just assigned to true.  All other literals
+// of these constraints are assigned to false with the covered binary
+// clause as reason, which is stored in 'rtab' at the index of the assigned
+// variable.  A conflict is stored at index zero, unless the two literals
+// are on different levels.  Then with chronological backtracking the
+// conflict is used as driving clause for the literal on the higher level
+// (see 'analyze') and we have to use its slot in 'rtab' instead.
+
+inline void Internal::propagate_cards (int lit) {
+  for (const auto & offset : ctab[vlit (lit)]) {
+    for (const int * p = &cards[offset]; *p; p++) {
+      const int other = *p;
+      if (other == lit) continue;
+      const signed char tmp = val (other);
+      if (tmp < 0) continue;
+      if (tmp > 0) {
+        int idx = 0;
+        if (opts.chrono) {
+          const int l = var (lit).level, k = var (other).level;
+          if (l > k) idx = vidx (lit);
+          else if (k > l) idx = vidx (other);
+        }
+        Clause * c = &rtab[idx];
+        c->literals[0] = -lit;
+        c->literals[1] = -other;
+        conflict = c;
+        stats.cardconflicts++;
+        return;
+      }
+      Clause * c = &rtab[vidx (other)];
+      c->literals[0] = -other;
+      c->literals[1] = -lit;
+      search_assign (-other, c);
+    }
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // The 'propagate' function is usually the hot-spot of a CDCL SAT solver.
 // The 'trail' stack saves assigned variables and is used here as BFS queue
 // for checking clauses with the negation of assigned variables for being in
@@ -348,6 +388,8 @@ bool Internal::propagate () {
 
       ws.resize (j - ws.begin ());
     }
+
+    if (!conflict && !cards.empty ()) propagate_cards (-lit);
   } // 而如果已經找到 conflicting clause 了, 就也會順便跳出整個大迴圈, 停止遍歷 trail 裡其他剩下的 literal
 
   if (searching_lucky_phases) {
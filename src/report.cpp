@@ -22,13 +22,19 @@ F  backtracked after flipping phases
 B  backtracked after resetting to best phases
 W  backtracked after local search improved phases
 b  blocked clause elimination
+a  bounded variable addition
+A  removed autarky
 G  before garbage collection
 C  after garbage collection
 /  compacted internal literals and remapped external to internal
+g  globally blocked clause elimination (conditioning)
+k  congruence closure on extracted gates
 c  covered clause elimination
 d  decomposed binary implication graph and substituted equivalent literals
 2  removed duplicated binary clauses
+D  removed duplicated clauses of all sizes
 e  bounded variable elimination round
+x  Gaussian elimination on XOR constraints
 I  variable instantiation
 [  start of stable search phase
 ]  end of stable search phase
@@ -51,7 +57,9 @@ f  flushed redundant clauses
 R  restart
 s  subsumed clause removal round
 3  ternary resolution round
+=  SAT sweeping for backbones and equivalences
 t  transition reduction of binary implication graph
+u  unhiding redundancies through stamping binary implication graph
 w  vivified redundant and irredundant clauses
 v  vivified irredundant clauses
 
@@ -111,6 +119,9 @@ Report::Report (const char * h, int precision, int min, double value)
 #define MB \
   (current_resident_set_size () / (double)(1l<<20))
 
+#define ACCOUNTED \
+  (memory_usage () / (double)(1l<<20))
+
 #define REMAINING \
   (percent (active (), external->max_var))
 
@@ -127,6 +138,7 @@ Report::Report (const char * h, int precision, int min, double value)
 /*     HEADER, PRECISION, MIN, VALUE */ \
 REPORT("seconds",      2, 5, TIME) \
 REPORT("MB",           0, 2, MB) \
+REPORT("accounted",    0, 2, ACCOUNTED) \
 REPORT("level",        0, 2, averages.current.level) \
 REPORT("reductions",   0, 1, stats.reductions) \
 REPORT("restarts",     0, 3, stats.restarts) \
@@ -214,10 +226,12 @@ void Internal::report (char type, int verbose) {
   switch (type) {
     case '[': case ']':           tout.magenta (true); break;
     case 's': case 'v': case 'w':
-    case 't': case 'b': case 'c': tout.green (false); break;
-    case 'e':                     tout.green (true); break;
-    case 'p': case '2': case '3': tout.blue (false); break;
-    case 'd':                     tout.blue (true); break;
+    case 't': case 'u':
+    case 'b': case 'c': case 'A': tout.green (false); break;
+    case 'a': case 'e':           tout.green (true); break;
+    case 'p': case '2': case 'D': case '3':
+    case 'x': case '=':           tout.blue (false); break;
+    case 'd': case 'g': case 'k': tout.blue (true); break;
     case 'z': case 'f':           tout.cyan (true); break;
     case '-':                     tout.normal (); break;
     case '/':                     tout.yellow (true); break;
@@ -72,4 +72,22 @@ size_t current_resident_set_size () {
   return scanned == 2 ? rss * sysconf (_SC_PAGESIZE) : 0;
 }
 
+/*------------------------------------------------------------------------*/
+
+// The memory actually backed by transparent huge pages can only be
+// determined through the '/proc' file system too, which summarizes it in
+// the 'AnonHugePages' line of 'smaps_rollup' (since Linux 4.14).
+
+size_t huge_pages_resident_set_size () {
+  FILE * file = fopen ("/proc/self/smaps_rollup", "r");
+  if (!file) return 0;
+  char line[128];
+  int64_t kb = 0;
+  while (fgets (line, sizeof line, file))
+    if (sscanf (line, "AnonHugePages: %" PRId64 " kB", &kb) == 1)
+      break;
+  fclose (file);
+  return ((size_t) kb) << 10;
+}
+
 }
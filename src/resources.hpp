@@ -8,6 +8,7 @@ double absolute_process_time ();
 
 size_t maximum_resident_set_size ();
 size_t current_resident_set_size ();
+size_t huge_pages_resident_set_size ();
 
 }
 
@@ -76,9 +76,7 @@ void External::restore_clauses () {
     PHASE ("restore", internal->stats.restorations,
       "forced to restore all clauses");
 
-  unsigned numtainted = 0;
-  for (const auto & b : tainted)
-    if (b) numtainted++;
+  size_t numtainted = tainted.count ();
 
   PHASE ("restore", internal->stats.restorations,
     "starting with %zd tainted literals %.0f%%",
@@ -187,9 +185,7 @@ void External::restore_clauses () {
       clauses.weakened);
 #endif
 
-  numtainted = 0;
-  for (const auto & b : tainted)
-    if (b) numtainted++;
+  numtainted = tainted.count ();
 
   PHASE ("restore", internal->stats.restorations,
     "finishing with %zd tainted literals %.0f%%",
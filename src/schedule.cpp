@@ -0,0 +1,97 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Payoff driven scheduling of the main inprocessors 'probe', 'subsume' and
+// 'elim'.  Each call is measured in terms of its gain, which is the number
+// of removed active variables (units, equivalences, eliminated variables)
+// plus the number of removed irredundant clauses, and its cost.  The
+// smoothed gain per cost of a technique relative to the average over all
+// techniques scales its effort limits (the '*releff' budgets) in the range
+// '1/schedulescale' to 'schedulescale'.  If a technique did not gain
+// anything for 'schedulefruitless' consecutive calls its conflict interval
+// is multiplied by 'schedulescale' which in effect skips the next rounds.
+//
+// The cost is not measured in time, since otherwise scheduling and thus
+// the whole solver would not be deterministic anymore.  The techniques
+// count their work in different units though (propagations, subsumption
+// checks and resolutions), which can not just be added up.  Instead each
+// work counter is converted to search propagations with the relative
+// efficiency ('*releff' in per mille) of the technique it belongs to.
+// This is the same exchange rate the effort limits are computed with, and
+// thus one unit of cost is the same for all techniques.
+
+/*------------------------------------------------------------------------*/
+
+double Internal::schedule_cost () {
+  double res = 0;
+  res += 1e3 * stats.subchecks / opts.subsumereleff;
+  res += 1e3 * stats.elimres / opts.elimreleff;
+  res += 1e3 * stats.propagations.cover / opts.coverreleff;
+  res += 1e3 * stats.propagations.instantiate / opts.elimreleff; // in elim
+  res += 1e3 * stats.propagations.probe / opts.probereleff;
+  res += 1e3 * stats.propagations.transred / opts.transredreleff;
+  res += 1e3 * stats.propagations.vivify / opts.vivifyreleff;
+  return res;
+}
+
+void Internal::schedule_begin (Payoff & payoff) {
+  payoff.started = schedule_cost ();
+  payoff.active = active ();
+  payoff.irredundant = stats.current.irredundant;
+}
+
+void Internal::schedule_end (Payoff & payoff, const char * name) {
+  const double cost = max (1.0, schedule_cost () - payoff.started);
+  int64_t gain = 0;
+  if (payoff.active > active ())
+    gain += payoff.active - active ();
+  if (payoff.irredundant > stats.current.irredundant)
+    gain += payoff.irredundant - stats.current.irredundant;
+  const double rate = 1e6 * gain / cost;
+  if (payoff.calls++) payoff.rate = (payoff.rate + rate) / 2;
+  else payoff.rate = rate;
+  if (gain) payoff.fruitless = 0;
+  else payoff.fruitless++;
+  PHASE ("schedule", payoff.calls,
+    "%s gained %" PRId64 " at cost of %.0f propagations "
+    "(%.0f per million, %d fruitless)",
+    name, gain, cost, payoff.rate, payoff.fruitless);
+#ifdef QUIET
+  (void) name;
+#endif
+}
+
+// Factor for effort limits.
+
+double Internal::schedule_effort (const Payoff & payoff) {
+  if (!opts.schedule) return 1;
+  if (!payoff.calls) return 1;
+  double sum = 0;
+  int count = 0;
+  for (const auto & p : { schedule.elim, schedule.probe, schedule.subsume })
+    if (p.calls) sum += p.rate, count++;
+  assert (count > 0);
+  const double average = sum / count;
+  if (average <= 0) return 1;
+  const double max_scale = opts.schedulescale;
+  double res = payoff.rate / average;
+  if (res < 1/max_scale) res = 1/max_scale;
+  if (res > max_scale) res = max_scale;
+  if (res > 1) stats.scheduleboosted++;
+  if (res < 1) stats.schedulereduced++;
+  return res;
+}
+
+// Factor for conflict intervals.
+
+double Internal::schedule_interval (const Payoff & payoff) {
+  if (!opts.schedule) return 1;
+  if (payoff.fruitless < opts.schedulefruitless) return 1;
+  stats.scheduledelayed++;
+  return opts.schedulescale;
+}
+
+}
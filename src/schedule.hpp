@@ -0,0 +1,27 @@
+#ifndef _schedule_hpp_INCLUDED
+#define _schedule_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Payoff of an inprocessing technique measured in 'schedule.cpp'.
+
+struct Payoff {
+
+  double started;       // cost (see 'schedule_cost') when call started
+  int64_t active;       // active variables when last call started
+  int64_t irredundant;  // irredundant clauses when last call started
+
+  int64_t calls;        // number of measured calls
+  double rate;          // smoothed gain per million cost units
+  int fruitless;        // consecutive calls without gain
+
+  Payoff () { memset (this, 0, sizeof *this); }
+};
+
+struct Schedule {
+  Payoff elim, probe, subsume;
+};
+
+}
+
+#endif
@@ -602,6 +602,22 @@ int Solver::fixed (int lit) const {
   return res;
 }
 
+int Solver::backbone (std::vector<int> & lits, bool add) {
+  LOG_API_CALL_BEGIN ("backbone", add);
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () != ADDING,
+    "clause incomplete (terminating zero not added)");
+  transition_to_unknown_state ();
+  REQUIRE (external->assumptions.empty (),
+    "can not compute backbone under assumptions");
+  STATE (SOLVING);
+  int res = external->backbone (lits, add);
+  if (res == 20) STATE (UNSATISFIED);
+  else           STATE (UNKNOWN);
+  LOG_API_CALL_RETURNS ("backbone", add, res);
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::terminate () {
@@ -820,6 +836,32 @@ void Solver::statistics () {
 
 /*------------------------------------------------------------------------*/
 
+size_t Solver::memory_usage () const {
+  LOG_API_CALL_BEGIN ("memory_usage");
+  REQUIRE_VALID_STATE ();
+  size_t res = internal->memory_usage ();
+  LOG_API_CALL_RETURNS ("memory_usage", (int64_t) res);
+  return res;
+}
+
+bool Solver::traverse_memory_usage (MemoryIterator & it) const {
+  LOG_API_CALL_BEGIN ("traverse_memory_usage");
+  REQUIRE_VALID_STATE ();
+  Memory memory;
+  internal->memory_usage (memory);
+  bool res = true;
+#define MEMORY(NAME) \
+  if (res && \
+      !it.memory (#NAME, memory.NAME.used, memory.NAME.reserved)) \
+    res = false;
+  MEMORY_SUBSYSTEMS
+#undef MEMORY
+  LOG_API_CALL_RETURNS ("traverse_memory_usage", res);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 const char * Solver::read_dimacs (File * file, int & vars, int strict) {
   REQUIRE_VALID_STATE ();
   REQUIRE (state () == CONFIGURING,
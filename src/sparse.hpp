@@ -0,0 +1,149 @@
+#ifndef _sparse_hpp_INCLUDED
+#define _sparse_hpp_INCLUDED
+
+#include "util.hpp"     // Alphabetically after 'sparse.hpp'.
+
+namespace CaDiCaL {
+
+using namespace std;
+
+// A two-level table mapping (usually external) variable indices to values.
+// The first level is a vector of pointers to fixed size pages, which are
+// only allocated on demand if a value on that page is written.  Entries on
+// unallocated pages are considered to be zero.  Thus the memory used by a
+// table scales with the number of used indices (or more precisely with the
+// number of touched pages) and not with the maximum index, except for the
+// first level pointers, which take only a fraction of the page size.
+//
+// Reading through 'operator[]' never allocates pages, while writing has to
+// go through 'ref', which allocates the page of the entry if necessary.
+
+template<class T> class Sparse {
+
+  static const unsigned log_page_size = 12;
+  static const size_t page_size = (size_t) 1 << log_page_size;
+  static const size_t page_mask = page_size - 1;
+
+  vector<T*> pages;
+  size_t allocated;     // Number of allocated pages.
+
+  Sparse (const Sparse &);
+  Sparse & operator = (const Sparse &);
+
+public:
+
+  Sparse () : allocated (0) { }
+  ~Sparse () { clear (); }
+
+  T operator [] (size_t i) const {
+    const size_t p = i >> log_page_size;
+    if (p >= pages.size ()) return T ();
+    const T * page = pages[p];
+    if (!page) return T ();
+    return page[i & page_mask];
+  }
+
+  T & ref (size_t i) {
+    const size_t p = i >> log_page_size;
+    if (p >= pages.size ()) pages.resize (p + 1, 0);
+    T * & page = pages[p];
+    if (!page) page = new T [page_size] (), allocated++;
+    return page[i & page_mask];
+  }
+
+  // No page allocated means all entries are zero.
+  //
+  bool empty () const { return !allocated; }
+
+  // Number of non-zero entries.
+  //
+  size_t count () const {
+    size_t res = 0;
+    for (const auto & page : pages)
+      if (page)
+        for (size_t i = 0; i < page_size; i++)
+          if (page[i]) res++;
+    return res;
+  }
+
+  // Reset all entries to zero and release all memory.
+  //
+  void clear () {
+    for (const auto & page : pages)
+      if (page) delete [] page;
+    pages.clear ();
+    shrink_vector (pages);
+    allocated = 0;
+  }
+
+  size_t bytes () const {
+    return allocated * page_size * sizeof (T) +
+           pages.capacity () * sizeof (T*);
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+// Tables indexed by external variables (or literals).  By default these are
+// plain dense vectors, which are enlarged on demand if an entry beyond the
+// end is set to a non-zero value.  Only if 'opts.sparse' is set before the
+// first external variable is initialized, the table is switched to the
+// two-level 'Sparse' representation above.  In both modes reading entries
+// beyond the end gives zero and writing has to go through 'set'.
+
+template<class T> class Table {
+
+  vector<T> dense;
+  Sparse<T> paged;
+  bool sparse;          // Use 'paged' instead of 'dense'.
+
+  Table (const Table &);
+  Table & operator = (const Table &);
+
+public:
+
+  Table () : sparse (false) { }
+
+  void use_sparse () {
+    assert (dense.empty ());
+    sparse = true;
+  }
+
+  T operator [] (size_t i) const {
+    if (sparse) return paged[i];
+    return i < dense.size () ? dense[i] : T ();
+  }
+
+  void set (size_t i, const T & v) {
+    if (sparse) { paged.ref (i) = v; return; }
+    if (i >= dense.size ()) {
+      if (v == T ()) return;
+      dense.resize (i + 1, T ());
+    }
+    dense[i] = v;
+  }
+
+  bool empty () const { return sparse ? paged.empty () : dense.empty (); }
+
+  size_t count () const {
+    if (sparse) return paged.count ();
+    size_t res = 0;
+    for (size_t i = 0; i < dense.size (); i++)
+      if (dense[i]) res++;
+    return res;
+  }
+
+  void clear () {
+    if (sparse) paged.clear ();
+    else dense.clear ();
+  }
+
+  size_t bytes () const {
+    if (sparse) return paged.bytes ();
+    return dense.capacity () * sizeof (T);
+  }
+};
+
+}
+
+#endif
@@ -49,12 +49,23 @@ void Stats::print (Internal * internal) {
   propagations += stats.propagations.walk;
 
   int64_t vivified = stats.vivifysubs + stats.vivifystrs;
+  int64_t unhidden = stats.unhideunits + stats.unhidetauts + stats.unhidestrs;
 
   size_t extendbytes = internal->external->extension.size ();
   extendbytes *= sizeof (int);
 
   SECTION ("statistics");
 
+  if (all || stats.autarkyvars) {
+  PRT ("autarky:         %15" PRId64 "   %10.2f %%  of all variables", stats.autarkyvars, percent (stats.autarkyvars, stats.vars));
+  PRT ("  phases:        %15" PRId64 "   %10.2f    per phase", stats.autarkies, relative (stats.autarkyvars, stats.autarkies));
+  PRT ("  clauses:       %15" PRId64 "   %10.2f    per variable", stats.autarkyclauses, relative (stats.autarkyclauses, stats.autarkyvars));
+  }
+  if (all || stats.backbones) {
+  PRT ("backbone:        %15" PRId64 "   %10.2f    per extraction", stats.backbonelits, relative (stats.backbonelits, stats.backbones));
+  PRT ("  extractions:   %15" PRId64 "   %10.2f    calls per extraction", stats.backbones, relative (stats.backbonecalls, stats.backbones));
+  PRT ("  calls:         %15" PRId64 "   %10.2f    per literal", stats.backbonecalls, relative (stats.backbonecalls, stats.backbonelits));
+  }
   if (all || stats.blocked) {
   PRT ("blocked:         %15" PRId64 "   %10.2f %%  of irredundant clauses", stats.blocked, percent (stats.blocked, stats.added.irredundant));
   PRT ("  blockings:     %15" PRId64 "   %10.2f    internal", stats.blockings, relative (stats.conflicts, stats.blockings));
@@ -63,10 +74,26 @@ void Stats::print (Internal * internal) {
   PRT ("  pure:          %15" PRId64 "   %10.2f %%  of all variables", stats.all.pure, percent (stats.all.pure, stats.vars));
   PRT ("  pureclauses:   %15" PRId64 "   %10.2f    per pure literal", stats.blockpured, relative (stats.blockpured, stats.all.pure));
   }
+  if (all || stats.bvavars) {
+  PRT ("bva:             %15" PRId64 "   %10.2f    per phase", stats.bvavars, relative (stats.bvavars, stats.bva));
+  PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.bva, relative (stats.conflicts, stats.bva));
+  PRT ("  added:         %15" PRId64 "   %10.2f    per variable", stats.bvaadded, relative (stats.bvaadded, stats.bvavars));
+  PRT ("  removed:       %15" PRId64 "   %10.2f    per variable", stats.bvaremoved, relative (stats.bvaremoved, stats.bvavars));
+  }
+  if (all || stats.cards) {
+  PRT ("cards:           %15" PRId64 "   %10.2f    per detection", stats.cards, relative (stats.cards, stats.carddetections));
+  PRT ("  detections:    %15" PRId64 "   %10.2f    interval", stats.carddetections, relative (stats.conflicts, stats.carddetections));
+  PRT ("  cardlits:      %15" PRId64 "   %10.2f    per constraint", stats.cardlits, relative (stats.cardlits, stats.cards));
+  PRT ("  unwatched:     %15" PRId64 "   %10.2f    per constraint", stats.cardunwatched, relative (stats.cardunwatched, stats.cards));
+  PRT ("  conflicts:     %15" PRId64 "   %10.2f %%  of conflicts", stats.cardconflicts, percent (stats.cardconflicts, stats.conflicts));
+  }
   if (all || stats.chrono)
   PRT ("chronological:   %15" PRId64 "   %10.2f %%  of conflicts", stats.chrono, percent (stats.chrono, stats.conflicts));
-  if (all)
+  if (all || stats.compacts) {
   PRT ("compacts:        %15" PRId64 "   %10.2f    interval", stats.compacts, relative (stats.conflicts, stats.compacts));
+  if (all || stats.renumbered)
+  PRT ("  renumbered:    %15" PRId64 "   %10.2f %%  of compacts", stats.renumbered, percent (stats.renumbered, stats.compacts));
+  }
   if (all || stats.conflicts) {
   PRT ("conflicts:       %15" PRId64 "   %10.2f    per second", stats.conflicts, relative (stats.conflicts, t));
   PRT ("  backtracked:   %15" PRId64 "   %10.2f %%  of conflicts", stats.backtracks, percent (stats.backtracks, stats.conflicts));
@@ -83,6 +110,14 @@ void Stats::print (Internal * internal) {
   PRT ("  condautrem:    %19.3f  %7.2f %%  final autarky", relative (stats.condautrem, stats.conditioned), percent (stats.condautrem, stats.condassrem));
   PRT ("  condprops:     %15ld   %10.2f    per candidate", stats.condprops, relative (stats.condprops, stats.condcands));
   }
+  if (all || stats.congruencemerged || stats.congruenceclashes) {
+  PRT ("congruence:      %15" PRId64 "   %10.2f    per phase", stats.congruencemerged, relative (stats.congruencemerged, stats.congruence));
+  PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.congruence, relative (stats.conflicts, stats.congruence));
+  PRT ("  ands:          %15" PRId64 "   %10.2f    per phase", stats.congruenceands, relative (stats.congruenceands, stats.congruence));
+  PRT ("  xors:          %15" PRId64 "   %10.2f    per phase", stats.congruencexors, relative (stats.congruencexors, stats.congruence));
+  PRT ("  ites:          %15" PRId64 "   %10.2f    per phase", stats.congruenceites, relative (stats.congruenceites, stats.congruence));
+  PRT ("  clashes:       %15" PRId64 "   %10.2f    per phase", stats.congruenceclashes, relative (stats.congruenceclashes, stats.congruence));
+  }
   if (all || stats.cover.total) {
   PRT ("covered:         %15" PRId64 "   %10.2f %%  of irredundant clauses", stats.cover.total, percent (stats.cover.total, stats.added.irredundant));
   PRT ("  coverings:     %15" PRId64 "   %10.2f    interval", stats.cover.count, relative (stats.conflicts, stats.cover.count));
@@ -98,11 +133,15 @@ void Stats::print (Internal * internal) {
   PRT ("  elimphases:    %15" PRId64 "   %10.2f    interval", stats.elimphases, relative (stats.conflicts, stats.elimphases));
   PRT ("  elimrounds:    %15" PRId64 "   %10.2f    per phase", stats.elimrounds, relative (stats.elimrounds, stats.elimphases));
   PRT ("  elimtried:     %15" PRId64 "   %10.2f %%  eliminated", stats.elimtried, percent (stats.all.eliminated, stats.elimtried));
+  PRT ("  elimbatches:   %15" PRId64 "   %10.2f    candidates per batch", stats.elimbatches, relative (stats.elimbatched, stats.elimbatches));
+  PRT ("  elimfallbacks: %15" PRId64 "   %10.2f %%  of batched", stats.elimfallbacks, percent (stats.elimfallbacks, stats.elimbatched));
   PRT ("  elimgates:     %15" PRId64 "   %10.2f %%  gates per tried", stats.elimgates, percent (stats.elimgates, stats.elimtried));
   PRT ("  elimequivs:    %15" PRId64 "   %10.2f %%  equivalence gates", stats.elimequivs, percent (stats.elimequivs, stats.elimgates));
   PRT ("  elimands:      %15" PRId64 "   %10.2f %%  and gates", stats.elimands, percent (stats.elimands, stats.elimgates));
   PRT ("  elimites:      %15" PRId64 "   %10.2f %%  if-then-else gates", stats.elimites, percent (stats.elimites, stats.elimgates));
   PRT ("  elimxors:      %15" PRId64 "   %10.2f %%  xor gates", stats.elimxors, percent (stats.elimxors, stats.elimgates));
+  PRT ("  elimdefs:      %15" PRId64 "   %10.2f %%  definitions", stats.elimdefs, percent (stats.elimdefs, stats.elimgates));
+  PRT ("  elimdeftried:  %15" PRId64 "   %10.2f %%  found definitions", stats.elimdeftried, percent (stats.elimdefs, stats.elimdeftried));
   PRT ("  elimsubst:     %15" PRId64 "   %10.2f %%  substituted", stats.elimsubst, percent (stats.elimsubst, stats.all.eliminated));
   PRT ("  elimres:       %15" PRId64 "   %10.2f    per eliminated", stats.elimres, relative (stats.elimres, stats.all.eliminated));
   PRT ("  elimrestried:  %15" PRId64 "   %10.2f %%  per resolution", stats.elimrestried, percent (stats.elimrestried, stats.elimres));
@@ -115,6 +154,9 @@ void Stats::print (Internal * internal) {
   PRT ("  probingphases: %15" PRId64 "   %10.2f    interval", stats.probingphases, relative (stats.conflicts, stats.probingphases));
   PRT ("  probingrounds: %15" PRId64 "   %10.2f    per phase", stats.probingrounds, relative (stats.probingrounds, stats.probingphases));
   PRT ("  probed:        %15" PRId64 "   %10.2f    per failed", stats.probed, relative (stats.probed, stats.failed));
+  PRT ("  probeparallel: %15" PRId64 "   %10.2f    per round", stats.probeparallel, relative (stats.probeparallel, stats.probingrounds));
+  PRT ("  probeunits:    %15" PRId64 "   %10.2f %%  per probed", stats.probeunits, percent (stats.probeunits, stats.probed));
+  PRT ("  probetrees:    %15" PRId64 "   %10.2f    per round", stats.probetrees, relative (stats.probetrees, stats.probingrounds));
   PRT ("  hbrs:          %15" PRId64 "   %10.2f    per probed", stats.hbrs, relative (stats.hbrs, stats.probed));
   PRT ("  hbrsizes:      %15" PRId64 "   %10.2f    per hbr", stats.hbrsizes, relative (stats.hbrsizes, stats.hbrs));
   PRT ("  hbreds:        %15" PRId64 "   %10.2f %%  per hbr", stats.hbreds, percent (stats.hbreds, stats.hbrs));
@@ -127,6 +169,20 @@ void Stats::print (Internal * internal) {
   PRT ("  hyper:         %15" PRId64 "   %10.2f %%  per conflict", stats.flush.hyper, relative (stats.flush.hyper, stats.conflicts));
   PRT ("  flushings:     %15" PRId64 "   %10.2f    interval", stats.flush.count, relative (stats.conflicts, stats.flush.count));
   }
+  if (all || stats.gaussxors) {
+  PRT ("gauss:           %15" PRId64 "   %10.2f    per phase", stats.gaussxors, relative (stats.gaussxors, stats.gauss));
+  PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.gauss, relative (stats.conflicts, stats.gauss));
+  PRT ("  added:         %15" PRId64 "   %10.2f    per XOR", stats.gaussadded, relative (stats.gaussadded, stats.gaussxors));
+  PRT ("  skipped:       %15" PRId64 "   %10.2f %%  of added", stats.gaussskipped, percent (stats.gaussskipped, stats.gaussadded));
+  PRT ("  units:         %15" PRId64 "   %10.2f %%  of XORs", stats.gaussunits, percent (stats.gaussunits, stats.gaussxors));
+  PRT ("  equivalences:  %15" PRId64 "   %10.2f %%  of XORs", stats.gaussequivs, percent (stats.gaussequivs, stats.gaussxors));
+  }
+  if (all || stats.hugepages.advised) {
+  PRT ("hugepages:       %15" PRId64 "   %10.2f    MB advised", stats.hugepages.advised, stats.hugepages.advised/(double)(1l<<20));
+  PRT ("  mapped:        %15" PRId64 "   %10.2f    MB in regions", stats.hugepages.mapped, stats.hugepages.mapped/(double)(1l<<20));
+  PRT ("  regions:       %15" PRId64 "   %10.2f    MB per region", stats.hugepages.regions, relative (stats.hugepages.mapped/(double)(1l<<20), stats.hugepages.regions));
+  PRT ("  released:      %15" PRId64 "   %10.2f    MB released", stats.hugepages.released, stats.hugepages.released/(double)(1l<<20));
+  }
   if (all || stats.instantiated) {
   PRT ("instantiated:    %15" PRId64 "   %10.2f %%  of tried", stats.instantiated, percent (stats.instantiated, stats.instried));
   PRT ("  instrounds:    %15" PRId64 "   %10.2f %%  of elimrounds", stats.instrounds, percent (stats.instrounds, stats.elimrounds));
@@ -167,6 +223,8 @@ void Stats::print (Internal * internal) {
   PRT ("reduced:         %15" PRId64 "   %10.2f %%  per conflict", stats.reduced, percent (stats.reduced, stats.conflicts));
   PRT ("  reductions:    %15" PRId64 "   %10.2f    interval", stats.reductions, relative (stats.conflicts, stats.reductions));
   PRT ("  collections:   %15" PRId64 "   %10.2f    interval", stats.collections, relative (stats.conflicts, stats.collections));
+  if (all || stats.parcollections)
+  PRT ("    parallel:    %15" PRId64 "   %10.2f %%  of collections", stats.parcollections, percent (stats.parcollections, stats.collections));
   }
   if (all || stats.rephased.total) {
   PRT ("rephased:        %15" PRId64 "   %10.2f    interval", stats.rephased.total, relative (stats.conflicts, stats.rephased.total));
@@ -189,6 +247,14 @@ void Stats::print (Internal * internal) {
   PRT ("  restorations:  %15" PRId64 "   %10.2f %%  per extension", stats.restorations, percent (stats.restorations, stats.extensions));
   PRT ("  literals:      %15" PRId64 "   %10.2f    per restored clause", stats.restoredlits, relative (stats.restoredlits, stats.restored));
   }
+  if (all || stats.scheduleboosted || stats.schedulereduced ||
+      stats.scheduledelayed) {
+  const int64_t phases = stats.probingphases + stats.subsumephases + stats.elimphases;
+  const int64_t rounds = stats.probingrounds + stats.subsumerounds + stats.elimrounds;
+  PRT ("schedule:        %15" PRId64 "   %10.2f %%  delayed phases", stats.scheduledelayed, percent (stats.scheduledelayed, phases));
+  PRT ("  boosted:       %15" PRId64 "   %10.2f %%  of rounds", stats.scheduleboosted, percent (stats.scheduleboosted, rounds));
+  PRT ("  reduced:       %15" PRId64 "   %10.2f %%  of rounds", stats.schedulereduced, percent (stats.schedulereduced, rounds));
+  }
   if (all || stats.stabphases) {
   PRT ("stabilizing:     %15" PRId64 "   %10.2f %%  of conflicts", stats.stabphases, percent (stats.stabconflicts, stats.conflicts));
   PRT ("  restartstab:   %15" PRId64 "   %10.2f %%  of all restarts", stats.restartstable, percent (stats.restartstable, stats.restarts));
@@ -203,6 +269,8 @@ void Stats::print (Internal * internal) {
   PRT ("  subsumephases: %15" PRId64 "   %10.2f    interval", stats.subsumephases, relative (stats.conflicts, stats.subsumephases));
   PRT ("  subsumerounds: %15" PRId64 "   %10.2f    per phase", stats.subsumerounds, relative (stats.subsumerounds, stats.subsumephases));
   PRT ("  deduplicated:  %15" PRId64 "   %10.2f %%  per subsumed", stats.deduplicated, percent (stats.deduplicated, stats.subsumed));
+  PRT ("  dedups:        %15" PRId64 "   %10.2f    per elim phase", stats.dedups, relative (stats.dedups, stats.elimphases));
+  PRT ("  dedupstrs:     %15" PRId64 "   %10.2f %%  per strengthened", stats.dedupstrs, percent (stats.dedupstrs, stats.strengthened));
   PRT ("  transreds:     %15" PRId64 "   %10.2f    interval", stats.transreds, relative (stats.conflicts, stats.transreds));
   PRT ("  transitive:    %15" PRId64 "   %10.2f %%  per subsumed", stats.transitive, percent (stats.transitive, stats.subsumed));
   PRT ("  subirr:        %15" PRId64 "   %10.2f %%  of subsumed", stats.subirr, percent (stats.subirr, stats.subsumed));
@@ -210,6 +278,9 @@ void Stats::print (Internal * internal) {
   PRT ("  subtried:      %15" PRId64 "   %10.2f    tried per subsumed", stats.subtried, relative (stats.subtried, stats.subsumed));
   PRT ("  subchecks:     %15" PRId64 "   %10.2f    per tried", stats.subchecks, relative (stats.subchecks, stats.subtried));
   PRT ("  subchecks2:    %15" PRId64 "   %10.2f %%  per subcheck", stats.subchecks2, percent (stats.subchecks2, stats.subchecks));
+  PRT ("  sigchecks:     %15" PRId64 "   %10.2f %%  rejected", stats.sigchecks, percent (stats.sigrejects, stats.sigchecks));
+  PRT ("  sigsaved:      %15" PRId64 "   %10.2f    literals per reject", stats.sigsaved, relative (stats.sigsaved, stats.sigrejects));
+  PRT ("  subparallel:   %15" PRId64 "   %10.2f    per round", stats.subparallel, relative (stats.subparallel, stats.subsumerounds));
   PRT ("  elimotfsub:    %15" PRId64 "   %10.2f %%  of subsumed", stats.elimotfsub, percent (stats.elimotfsub, stats.subsumed));
   PRT ("  elimbwsub:     %15" PRId64 "   %10.2f %%  of subsumed", stats.elimbwsub, percent (stats.elimbwsub, stats.subsumed));
   PRT ("  eagersub:      %15" PRId64 "   %10.2f %%  of subsumed", stats.eagersub, percent (stats.eagersub, stats.subsumed));
@@ -220,12 +291,28 @@ void Stats::print (Internal * internal) {
   PRT ("  elimotfstr:    %15" PRId64 "   %10.2f %%  of strengthened", stats.elimotfstr, percent (stats.elimotfstr, stats.strengthened));
   PRT ("  elimbwstr:     %15" PRId64 "   %10.2f %%  of strengthened", stats.elimbwstr, percent (stats.elimbwstr, stats.strengthened));
   }
+  if (all || stats.sweepvars) {
+  PRT ("sweep:           %15" PRId64 "   %10.2f    per phase", stats.sweepvars, relative (stats.sweepvars, stats.sweep));
+  PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.sweep, relative (stats.conflicts, stats.sweep));
+  PRT ("  solved:        %15" PRId64 "   %10.2f    per variable", stats.sweepsolved, relative (stats.sweepsolved, stats.sweepvars));
+  PRT ("  units:         %15" PRId64 "   %10.2f %%  of variables", stats.sweepunits, percent (stats.sweepunits, stats.sweepvars));
+  PRT ("  equivalences:  %15" PRId64 "   %10.2f %%  of variables", stats.sweepequivs, percent (stats.sweepequivs, stats.sweepvars));
+  }
   if (all || stats.htrs) {
   PRT ("ternary:         %15" PRId64 "   %10.2f %%  of resolved", stats.htrs, percent (stats.htrs, stats.ternres));
   PRT ("  phases:        %15" PRId64 "   %10.2f    interval", stats.ternary, relative (stats.conflicts, stats.ternary));
   PRT ("  htr3:          %15" PRId64 "   %10.2f %%  ternary hyper ternres", stats.htrs3, percent (stats.htrs3, stats.htrs));
   PRT ("  htr2:          %15" PRId64 "   %10.2f %%  binary hyper ternres", stats.htrs2, percent (stats.htrs2, stats.htrs));
   }
+  if (all || unhidden) {
+  PRT ("unhidden:        %15" PRId64 "   %10.2f    per phase", unhidden, relative (unhidden, stats.unhides));
+  PRT ("  unhides:       %15" PRId64 "   %10.2f    interval", stats.unhides, relative (stats.conflicts, stats.unhides));
+  PRT ("  unhiderounds:  %15" PRId64 "   %10.2f    per phase", stats.unhiderounds, relative (stats.unhiderounds, stats.unhides));
+  PRT ("  unhideticks:   %15" PRId64 "   %10.2f    per round", stats.unhideticks, relative (stats.unhideticks, stats.unhiderounds));
+  PRT ("  unhideunits:   %15" PRId64 "   %10.2f %%  of unhidden", stats.unhideunits, percent (stats.unhideunits, unhidden));
+  PRT ("  unhidetauts:   %15" PRId64 "   %10.2f %%  of unhidden", stats.unhidetauts, percent (stats.unhidetauts, unhidden));
+  PRT ("  unhidestrs:    %15" PRId64 "   %10.2f %%  of unhidden", stats.unhidestrs, percent (stats.unhidestrs, unhidden));
+  }
   if (all || vivified) {
   PRT ("vivified:        %15" PRId64 "   %10.2f %%  of all clauses", vivified, percent (vivified, stats.added.total));
   PRT ("  vivifications: %15" PRId64 "   %10.2f    interval", stats.vivifications, relative (stats.conflicts, stats.vivifications));
@@ -240,6 +327,10 @@ void Stats::print (Internal * internal) {
   PRT ("  vivifystred3:  %15" PRId64 "   %10.2f %%  per vivifystrs", stats.vivifystred3, percent (stats.vivifystred3, stats.vivifystrs));
   PRT ("  vivifydecs:    %15" PRId64 "   %10.2f    per checks", stats.vivifydecs, relative (stats.vivifydecs, stats.vivifychecks));
   PRT ("  vivifyreused:  %15" PRId64 "   %10.2f %%  per decision", stats.vivifyreused, percent (stats.vivifyreused, stats.vivifydecs));
+  PRT ("  vivifysaved:   %15" PRId64 "   %10.2f    per reused", stats.vivifysaved, relative (stats.vivifysaved, stats.vivifyreused));
+  PRT ("  vivifybatches: %15" PRId64 "   %10.2f    per phase", stats.vivifybatches, relative (stats.vivifybatches, stats.vivifications));
+  PRT ("  vivifyparallel:%15" PRId64 "   %10.2f    per phase", stats.vivifyparallel, relative (stats.vivifyparallel, stats.vivifications));
+  PRT ("  vivifyrechecks:%15" PRId64 "   %10.2f %%  per check", stats.vivifyrechecks, percent (stats.vivifyrechecks, stats.vivifychecks));
   }
   if (all || stats.walk.count) {
   PRT ("walked:          %15" PRId64 "   %10.2f    interval", stats.walk.count, relative (stats.conflicts, stats.walk.count));
@@ -263,12 +354,29 @@ void Stats::print (Internal * internal) {
   MSG ("%sseconds are measured in %s time for solving%s",
     tout.magenta_code (), internal->opts.realtime ? "real" : "process", tout.normal_code ());
 
+  SECTION ("memory");
+
+  Memory memory;
+  internal->memory_usage (memory);
+  const Bytes total = memory.total ();
+  const double MB = 1l<<20;
+#define MEMORY(NAME) \
+  if (all || memory.NAME.reserved) \
+  PRT ("%-14s %12.2f MB used %12.2f MB reserved %6.2f %%", #NAME ":", memory.NAME.used/MB, memory.NAME.reserved/MB, percent (memory.NAME.reserved, total.reserved));
+  MEMORY_SUBSYSTEMS
+#undef MEMORY
+  PRT ("%-14s %12.2f MB used %12.2f MB reserved", "total:", total.used/MB, total.reserved/MB);
+
   SECTION ("resources");
 
   size_t m = maximum_resident_set_size ();
   PRT ("total process time since initialization: %12.2f    seconds", internal->process_time ());
   PRT ("total real time since initialization:    %12.2f    seconds", internal->real_time ());
   PRT ("maximum resident set size of process:    %12.2f    MB", m/(double)(1l<<20));
+  if (internal->opts.hugepages) {
+  size_t h = huge_pages_resident_set_size ();
+  PRT ("huge pages backed memory of process:     %12.2f    MB", h/(double)(1l<<20));
+  }
 
 #endif // ifndef QUIET
 
@@ -287,6 +395,7 @@ void Checker::print_stats () {
   MSG ("propagations:    %15" PRId64 "   %10.2f    per check", stats.propagations, relative (stats.propagations, stats.checks));
   MSG ("original:        %15" PRId64 "   %10.2f %%  of all clauses", stats.original, percent (stats.original, stats.added));
   MSG ("derived:         %15" PRId64 "   %10.2f %%  of all clauses", stats.derived, percent (stats.derived, stats.added));
+  MSG ("rats:            %15" PRId64 "   %10.2f %%  of derived clauses", stats.rats, percent (stats.rats, stats.derived));
   MSG ("deleted:         %15" PRId64 "   %10.2f %%  of all clauses", stats.deleted, percent (stats.deleted, stats.added));
   MSG ("insertions:      %15" PRId64 "   %10.2f %%  of all clauses", stats.insertions, percent (stats.insertions, stats.added));
   MSG ("collections:     %15" PRId64 "   %10.2f    deleted per collection", stats.collections, relative (stats.collections, stats.deleted));
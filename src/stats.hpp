@@ -26,6 +26,13 @@ struct Stats {
     int64_t walk;       // propagated during local search
   } propagations;
 
+  int64_t autarkies;    // number of autarky detection phases
+  int64_t autarkyvars;  // number of variables in autarkies
+  int64_t autarkyclauses;// number of clauses removed by autarkies
+  int64_t backbones;    // number of backbone extractions
+  int64_t backbonecalls;// number of 'solve' calls during extraction
+  int64_t backbonelits; // number of backbone literals found
+
   long condassinit;  // initial assigned literals
   long condassirem;  // initial assigned literals for blocked
   long condassrem;   // remaining assigned literals for blocked
@@ -91,7 +98,15 @@ struct Stats {
     int64_t hyper;      // flushed hyper binary/ternary clauses
   } flush;
 
+  struct {
+    int64_t regions;    // number of mapped regions
+    int64_t mapped;     // bytes in mapped regions
+    int64_t advised;    // bytes advised to be backed by huge pages
+    int64_t released;   // bytes released with 'MADV_DONTNEED'
+  } hugepages;
+
   int64_t compacts;     // number of compactifications
+  int64_t renumbered;   // compactifications renumbering variables
   int64_t shuffled;     // shuffled queues and scores
   int64_t restarts;     // actual number of happened restarts
   int64_t restartlevels;// levels at restart
@@ -115,6 +130,7 @@ struct Stats {
   int64_t reduced;      // number of reduced clauses
   int64_t collected;    // number of collected bytes
   int64_t collections;  // number of garbage collections
+  int64_t parcollections;//number of parallel garbage collections
   int64_t hbrs;         // hyper binary resolvents
   int64_t hbrsizes;     // sum of hyper resolved base clauses
   int64_t hbreds;       // redundant hyper binary resolvents
@@ -125,6 +141,8 @@ struct Stats {
   int64_t subsumed;     // number of subsumed clauses
   int64_t deduplicated; // number of removed duplicated binary clauses
   int64_t deduplications;//number of deduplication phases
+  int64_t dedups;       // deduplication phases of all clauses
+  int64_t dedupstrs;    // strengthened through resolved duplicates
   int64_t strengthened; // number of strengthened clauses
   int64_t elimotfstr;   // number of on-the-fly strengthened during elimination
   int64_t subirr;       // number of subsumed irredundant clauses
@@ -132,6 +150,10 @@ struct Stats {
   int64_t subtried;     // number of tried subsumptions
   int64_t subchecks;    // number of pair-wise subsumption checks
   int64_t subchecks2;   // same but restricted to binary clauses
+  int64_t subparallel;  // number of parallel subsumption segments
+  int64_t sigchecks;    // number of clause signature checks
+  int64_t sigrejects;   // number of pairs rejected by signatures
+  int64_t sigsaved;     // number of literals not visited due to signatures
   int64_t elimotfsub;   // number of on-the-fly subsumed during elimination
   int64_t subsumerounds;// number of subsumption rounds
   int64_t subsumephases;// number of scheduled subsumption phases
@@ -143,12 +165,17 @@ struct Stats {
   int64_t elimphases;   // number of scheduled elimination phases
   int64_t elimcompleted;// number complete elimination procedures
   int64_t elimtried;    // number of variable elimination attempts
+  int64_t elimbatches;  // number of parallel elimination batches
+  int64_t elimbatched;  // number of candidates in parallel batches
+  int64_t elimfallbacks;// number of sequential retries of batch candidates
   int64_t elimsubst;    // number of eliminations through substitutions
   int64_t elimgates;    // number of gates found during elimination
   int64_t elimequivs;   // number of equivalences found during elimination
   int64_t elimands;     // number of AND gates found during elimination
   int64_t elimites;     // number of ITE gates found during elimination
   int64_t elimxors;     // number of XOR gates found during elimination
+  int64_t elimdefs;     // number of semantic definitions found
+  int64_t elimdeftried; // number of tried semantic definitions
   int64_t elimbwsub;    // number of eager backward subsumed clauses
   int64_t elimbwstr;    // number of eager backward strengthened clauses
   int64_t ternary;      // number of ternary resolution phases
@@ -156,11 +183,44 @@ struct Stats {
   int64_t htrs;         // number of hyper ternary resolvents
   int64_t htrs2;        // number of binary hyper ternary resolvents
   int64_t htrs3;        // number of ternary hyper ternary resolvents
+  int64_t bva;          // number of variable addition phases
+  int64_t bvavars;      // number of added variables
+  int64_t bvaadded;     // number of clauses added by variable addition
+  int64_t bvaremoved;   // number of clauses replaced by variable addition
+  int64_t carddetections;// number of at-most-one detection phases
+  int64_t cards;        // number of detected at-most-one constraints
+  int64_t cardlits;     // number of literals in these constraints
+  int64_t cardunwatched;// number of covered binary clauses not watched
+  int64_t cardconflicts;// number of conflicts of these constraints
+  int64_t congruence;   // number of congruence closure phases
+  int64_t congruenceands;  // number of extracted AND gates
+  int64_t congruencexors;  // number of extracted XOR gates
+  int64_t congruenceites;  // number of extracted ITE gates
+  int64_t congruencemerged;// number of merged gate outputs
+  int64_t congruenceclashes;// number of complementary gate outputs
+  int64_t gauss;        // number of Gaussian elimination phases
+  int64_t gaussxors;    // number of extracted XOR constraints
+  int64_t gaussadded;   // number of row additions
+  int64_t gaussskipped; // number of row additions skipped due to proofs
+  int64_t gaussunits;   // number of units found by Gaussian elimination
+  int64_t gaussequivs;  // number of equivalences found
+  int64_t sweep;        // number of sweeping phases
+  int64_t sweepvars;    // number of swept variables
+  int64_t sweepsolved;  // number of sub-solver calls
+  int64_t sweepunits;   // number of backbone units found
+  int64_t sweepequivs;  // number of equivalences found
+  int64_t scheduleboosted; // effort limits increased due to payoff
+  int64_t schedulereduced; // effort limits decreased due to payoff
+  int64_t scheduledelayed; // phases delayed after fruitless calls
   int64_t decompositions; // number of SCC + ELS
   int64_t vivifications;  // number of vivifications
   int64_t vivifychecks; // checked clauses during vivification
   int64_t vivifydecs;   // vivification decisions
   int64_t vivifyreused; // reused vivification decisions
+  int64_t vivifysaved;  // propagated literals on reused decision levels
+  int64_t vivifybatches;// batches of candidates sorted in prefix order
+  int64_t vivifyparallel;// segments of candidates checked in parallel
+  int64_t vivifyrechecks;// sequential rechecks of parallel candidates
   int64_t vivifysched;  // scheduled clauses for vivification
   int64_t vivifysubs;   // subsumed clauses during vivification
   int64_t vivifystrs;   // strengthened clauses during vivification
@@ -171,6 +231,12 @@ struct Stats {
   int64_t vivifyunits;  // units during vivification
   int64_t transreds;
   int64_t transitive;
+  int64_t unhides;      // number of unhiding phases
+  int64_t unhiderounds; // number of unhiding rounds
+  int64_t unhideticks;  // stamping and clause checking steps
+  int64_t unhideunits;  // failed literals found by unhiding
+  int64_t unhidetauts;  // removed hidden tautologies
+  int64_t unhidestrs;   // removed hidden literals
   struct {
     int64_t literals;
     int64_t clauses;
@@ -178,14 +244,18 @@ struct Stats {
   int64_t minimized;    // minimized literals
   int64_t irrbytes;     // bytes of irredundant clauses
   int64_t garbage;      // bytes current irredundant garbage clauses
+  int64_t heapbytes;    // bytes of clauses allocated outside the arena
   int64_t units;        // learned unit clauses
   int64_t binaries;     // learned binary clauses
   int64_t probingphases;// number of scheduled probing phases
   int64_t probingrounds;// number of probing rounds
   int64_t probed;       // number of probed literals
+  int64_t probeparallel;// parallel probing segments
+  int64_t probetrees;   // forests of tree-based look-ahead
   int64_t failed;       // number of failed literals
   int64_t hyperunary;   // hyper unary resolved unit clauses
   int64_t probefailed;  // failed literals from probing
+  int64_t probeunits;   // units implied by both phases of probes
   int64_t transredunits;// units derived in transitive reduction
   int64_t blockings;    // number of blocked clause eliminations
   int64_t blocked;      // number of actually blocked clauses
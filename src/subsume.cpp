@@ -188,6 +188,8 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
 
   mark (c);     // signed!
 
+  const uint64_t sig = signing () ? signature (c) : 0;
+
   Clause * d = 0;
   int flipped = 0;
 
@@ -245,9 +247,23 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
       // code after the loop is used.
       //
       const Occs & os = occs (sign * lit);
-      for (const auto & e : os) {
+      for (size_t i = 0; i < os.size (); i++) {
+        Clause * e = os[i];
         assert (!e->garbage);                   // sanity check
         if (e->garbage) continue;               // defensive: not needed
+
+        // Checking the signature first avoids most literal accesses of
+        // clauses which can not subsume nor strengthen the candidate.
+        //
+        if (signing ()) {
+          stats.sigchecks++;
+          if (sigs (sign * lit)[i] & ~sig) {
+            stats.sigrejects++;
+            stats.sigsaved += e->size;
+            continue;
+          }
+        }
+
         flipped = subsume_check (e, c);
         if (!flipped) continue;
         d = e;                                  // leave also outer loop
@@ -279,6 +295,255 @@ Internal::try_to_subsume_clause (Clause * c, vector<Clause *> & shrunken) {
 
 /*------------------------------------------------------------------------*/
 
+// Parallel forward subsumption splits the schedule into segments of
+// candidates.  Workers check all candidates of a segment against the
+// clauses connected before the segment, which are not changed during this
+// parallel phase.  Each worker has its own marks and uses a read-only
+// version of 'subsume_check' (without moving literals).  The sequential
+// phase then goes over the candidates of the segment in order, checks
+// them in addition against the clauses connected earlier in the same
+// segment, i.e., the tails of the occurrence lists added after the
+// segment started, applies the result and connects the candidate as
+// before.  Since only candidates are removed or strengthened and
+// connected clauses are never changed, the results of the workers remain
+// valid during the sequential phase.
+//
+// The segment size does not depend on the number of workers, such that
+// results are the same for all numbers of threads.
+
+struct SubsumeResult {
+  Clause * subsuming;           // zero if binary or nothing found
+  int first, second;            // literals of subsuming binary clause
+  int flipped;                  // as returned by 'subsume_check'
+  int64_t checks, checks2;      // number of (binary) subsumption checks
+  int64_t sigchecks;            // number of signature checks ...
+  int64_t sigrejects, sigsaved; // ... rejected pairs and saved literals
+  SubsumeResult () :
+    subsuming (0), first (0), second (0), flipped (0),
+    checks (0), checks2 (0), sigchecks (0), sigrejects (0), sigsaved (0)
+  { }
+};
+
+struct SubsumeStart {
+  unsigned segment;             // segment in which 'occs' and 'bins' ...
+  unsigned occs, bins;          // ... had these sizes when first touched
+  SubsumeStart () : segment (0), occs (0), bins (0) { }
+};
+
+struct SubsumeSegment {
+
+  static const size_t size = 1 << 14;
+
+  Internal * internal;
+  unsigned stamp;                               // current segment
+  size_t begin, end;                            // segment in schedule
+  vector<Clause *> candidates;
+  vector<SubsumeResult> results;
+  vector<vector<signed char>> marks;            // per worker
+  vector<SubsumeStart> starts;                  // per literal
+
+  SubsumeSegment (Internal * i) : internal (i), stamp (0), begin (0), end (0) { }
+
+  // Remember the sizes of the occurrence lists of 'lit' before connecting
+  // the first clause to 'lit' in this segment.
+  //
+  void connecting (int lit) {
+    SubsumeStart & start = starts[internal->vlit (lit)];
+    if (start.segment == stamp) return;
+    start.segment = stamp;
+    start.occs = internal->occs (lit).size ();
+    start.bins = internal->bins (lit).size ();
+  }
+};
+
+// Find a clause connected to the literals of the marked candidate 'c',
+// which subsumes or strengthens 'c', starting at the positions in the
+// occurrence lists given by 'start'.  This is a read-only version of the
+// main loop of 'try_to_subsume_clause' shared by the workers and the
+// sequential phase, which use different 'marked' and 'start' functions.
+
+template<class Marked, class Start> static void
+find_subsuming_clause (Internal * internal, Clause * c,
+                       Marked marked, Start start, SubsumeResult & res)
+{
+  const uint64_t sig = internal->signing () ? internal->signature (c) : 0;
+
+  for (const auto & lit : *c) {
+
+    if (!internal->flags (lit).subsume) continue;
+
+    for (int sign = -1; sign <= 1; sign += 2) {
+
+      size_t begin_bins, begin_occs;
+      start (sign*lit, begin_bins, begin_occs);
+
+      const Bins & bs = internal->bins (sign*lit);
+      for (auto i = bs.begin () + begin_bins; i != bs.end (); i++) {
+        const int other = *i;
+        const int tmp = marked (other);
+        if (!tmp) continue;
+        if (tmp < 0 && sign < 0) continue;
+        if (tmp < 0) {
+          res.first = lit;
+          res.second = other;
+          res.flipped = other;
+        } else {
+          res.first = sign*lit;
+          res.second = other;
+          res.flipped = (sign < 0) ? -lit : INT_MIN;
+        }
+        return;
+      }
+
+      const Occs & os = internal->occs (sign*lit);
+      const Sigs * ss = internal->signing () ? &internal->sigs (sign*lit) : 0;
+      for (size_t i = begin_occs; i < os.size (); i++) {
+        Clause * e = os[i];
+        assert (!e->garbage);
+        assert (e != c);
+        assert (e->size <= c->size);
+        if (ss) {
+          res.sigchecks++;
+          if ((*ss)[i] & ~sig) {
+            res.sigrejects++;
+            res.sigsaved += e->size;
+            continue;
+          }
+        }
+        res.checks++;
+        if (e->size == 2) res.checks2++;
+        int flipped = 0;
+        bool failed = false;
+        for (const auto & other : *e) {
+          const int tmp = marked (other);
+          if (!tmp) failed = true;
+          else if (tmp > 0) continue;
+          else if (flipped) failed = true;
+          else flipped = other;
+          if (failed) break;
+        }
+        if (failed) continue;
+        if (!flipped) flipped = INT_MIN;
+        else if (!internal->opts.subsumestr) continue;
+        res.subsuming = e;
+        res.flipped = flipped;
+        return;
+      }
+    }
+  }
+}
+
+// Let the workers check the candidates of the next segment of the schedule.
+
+void Internal::subsume_segment_in_parallel (SubsumeSegment & segment) {
+
+  const size_t size = segment.candidates.size ();
+  const unsigned workers = parallel_workers (size);
+
+  if (segment.starts.empty ()) segment.starts.resize (2*(max_var + 1));
+  segment.stamp++;
+
+  if (segment.marks.size () < workers) segment.marks.resize (workers);
+  for (unsigned i = 0; i < workers; i++)
+    if (segment.marks[i].empty ())
+      segment.marks[i].resize (max_var + 1, 0);
+
+  segment.results.clear ();
+  segment.results.resize (size);
+
+  parallel_for (workers, size,
+    [&] (unsigned worker, size_t begin, size_t end) {
+      signed char * marks = segment.marks[worker].data ();
+      const auto marked = [marks] (int lit) {
+        const signed char res = marks[abs (lit)];
+        return lit < 0 ? -res : res;
+      };
+      const auto start = [] (int, size_t & bins, size_t & occs) {
+        bins = occs = 0;
+      };
+      for (size_t i = begin; i < end; i++) {
+        Clause * c = segment.candidates[i];
+        if (c->size <= 2 || !c->subsume) continue;
+        for (const auto & lit : *c) marks[abs (lit)] = sign (lit);
+        find_subsuming_clause (this, c, marked, start, segment.results[i]);
+        for (const auto & lit : *c) marks[abs (lit)] = 0;
+      }
+    });
+
+  stats.subparallel++;
+}
+
+// Sequential part of parallel subsumption for candidate 'c', which is the
+// 'i'-th candidate of the current segment.  It has the same contract as
+// 'try_to_subsume_clause'.
+
+int Internal::try_to_subsume_clause_in_segment (Clause * c, size_t i,
+                                                SubsumeSegment & segment,
+                                                vector<Clause *> & shrunken)
+{
+  stats.subtried++;
+  assert (!level);
+  assert (segment.candidates[i] == c);
+  LOG (c, "trying to subsume");
+
+  SubsumeResult res = segment.results[i];
+  stats.subchecks += res.checks;
+  stats.subchecks2 += res.checks2;
+  stats.sigchecks += res.sigchecks;
+  stats.sigrejects += res.sigrejects;
+  stats.sigsaved += res.sigsaved;
+
+  // Clauses connected in this segment might subsume the candidate, even
+  // if the workers found a strengthening clause.
+  //
+  if (res.flipped != INT_MIN) {
+    mark (c);
+    const unsigned stamp = segment.stamp;
+    const auto marked = [this] (int lit) { return this->marked (lit); };
+    const auto start = [&] (int lit, size_t & bins, size_t & occs) {
+      const SubsumeStart & s = segment.starts[vlit (lit)];
+      if (s.segment == stamp) bins = s.bins, occs = s.occs;
+      else bins = this->bins (lit).size (), occs = this->occs (lit).size ();
+    };
+    SubsumeResult tmp;
+    find_subsuming_clause (this, c, marked, start, tmp);
+    unmark (c);
+    stats.subchecks += tmp.checks;
+    stats.subchecks2 += tmp.checks2;
+    stats.sigchecks += tmp.sigchecks;
+    stats.sigrejects += tmp.sigrejects;
+    stats.sigsaved += tmp.sigsaved;
+    if (tmp.flipped == INT_MIN || !res.flipped) res = tmp;
+  }
+
+  Clause * d = res.subsuming;
+  if (res.flipped && !d) {
+    binary_subsuming.literals[0] = res.first;
+    binary_subsuming.literals[1] = res.second;
+    assert (binary_subsuming.size == 2);
+    assert (!binary_subsuming.redundant);
+    d = &binary_subsuming;
+  }
+
+  if (res.flipped == INT_MIN) {
+    LOG (d, "subsuming");
+    subsume_clause (d, c);
+    return 1;
+  }
+
+  if (res.flipped) {
+    LOG (d, "strengthening");
+    strengthen_clause (c, -res.flipped);
+    assert (likely_to_be_kept_clause (c));
+    shrunken.push_back (c);
+    return -1;
+  }
+
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Sorting the scheduled clauses is way faster if we compute and save the
 // clause size in the schedule to avoid pointer access to clauses during
 // sorting.  This slightly increases the schedule size though.
@@ -333,6 +598,7 @@ bool Internal::subsume_round () {
   if (opts.subsumelimited) {
     int64_t delta = stats.propagations.search;
     delta *= 1e-3 * opts.subsumereleff;
+    delta *= schedule_effort (schedule.subsume);
     if (delta < opts.subsumemineff) delta = opts.subsumemineff;
     if (delta > opts.subsumemaxeff) delta = opts.subsumemaxeff;
     delta = max (delta, (int64_t) 2l * active ());
@@ -425,16 +691,31 @@ bool Internal::subsume_round () {
 
   vector<Clause *> shrunken;
   init_occs ();
+  if (opts.signatures) init_sigs ();
   init_bins ();
 
-  for (const auto & s : schedule) {
+  // Check segments of candidates in parallel if enabled.
+  //
+  const bool parallel = opts.subsumeparallel && opts.threads > 1;
+  SubsumeSegment segment (this);
+
+  for (size_t i = 0; i < schedule.size (); i++) {
 
     if (terminating ()) break;
     if (stats.subchecks >= check_limit) break;
 
-    Clause * c = s.clause;
+    Clause * c = schedule[i].clause;
     assert (!c->garbage);
 
+    if (parallel && i == segment.end) {
+      segment.begin = i;
+      segment.end = min (i + SubsumeSegment::size, schedule.size ());
+      segment.candidates.clear ();
+      for (size_t j = i; j < segment.end; j++)
+        segment.candidates.push_back (schedule[j].clause);
+      subsume_segment_in_parallel (segment);
+    }
+
     checked++;
 
     // First try to subsume or strengthen this candidate clause.  For binary
@@ -447,7 +728,10 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      const int tmp = parallel ?
+        try_to_subsume_clause_in_segment (c, i - segment.begin,
+                                          segment, shrunken) :
+        try_to_subsume_clause (c, shrunken);
       if (tmp > 0) { subsumed++; continue; }
       if (tmp < 0) strengthened++;
     }
@@ -491,7 +775,8 @@ bool Internal::subsume_round () {
       LOG (c, "watching %d with %zd current and total %" PRId64 " occurrences",
         minlit, minsize, minoccs);
 
-      occs (minlit).push_back (c);
+      if (parallel) segment.connecting (minlit);
+      push_occs (minlit, c, signing () ? signature (c) : 0);
 
       // This sorting should give faster failures for assumption checks
       // since the less occurring variables are put first in a clause and
@@ -516,6 +801,7 @@ bool Internal::subsume_round () {
 
       const int minlit_pos = (c->literals[1] == minlit);
       const int other = c->literals[!minlit_pos];
+      if (parallel) segment.connecting (minlit);
       bins (minlit).push_back (other);
     }
   }
@@ -572,11 +858,15 @@ void Internal::subsume (bool update_limits) {
   if (unsat) return;
 
   backtrack ();
+  reset_cards ();
   if (!propagate ()) {
     learn_empty_clause ();
     return;
   }
 
+  schedule_begin (schedule.subsume);
+  begin_recycling_occs ();
+
   if (opts.subsume) {
     reset_watches ();
     subsume_round (); // line 323
@@ -588,16 +878,22 @@ void Internal::subsume (bool update_limits) {
     }
   }
 
-  // Schedule 'vivification' in 'subsume' as well as 'transitive reduction'.
+  // Schedule 'vivification' in 'subsume' as well as 'unhiding' and
+  // 'transitive reduction'.
   //
   if (opts.vivify) vivify (); // line 1062 of vivify.cpp
+  if (opts.unhide) unhide ();
   if (opts.transred) transred (); // line 11 of transred.cpp
 
+  end_recycling_occs ();
+  schedule_end (schedule.subsume, "subsume");
+
 UPDATE_LIMITS:
 
   if (!update_limits) return;
 
   int64_t delta = scale (opts.subsumeint * (stats.subsumephases + 1));
+  delta *= schedule_interval (schedule.subsume);
   lim.subsume = stats.conflicts + delta;
 
   PHASE ("subsume-phase", stats.subsumephases,
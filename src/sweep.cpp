@@ -0,0 +1,545 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// SAT sweeping finds backbone literals and equivalent literals, which are
+// semantically implied by the formula but neither found by failed literal
+// probing nor as strongly connected components of the binary implication
+// graph in 'decompose'.  For each scheduled variable we collect the
+// irredundant clauses in its neighborhood (up to 'sweepdepth' steps in the
+// variable-clause graph) and load them into a small embedded CDCL solver
+// ('Sweeper').  A first model gives candidates for equivalent literals,
+// i.e., the literals with the same value as the scheduled variable.  Then
+// we check whether the variable is a backbone and candidate equivalences
+// by solving under assumptions, where every model found refines the set of
+// remaining candidates.  Since the neighborhood is a subset of the formula
+// the results are implied by the full formula.  Units are assigned
+// directly, while equivalences are added as binary clauses and substituted
+// by 'decompose' afterwards.
+//
+// The sub-solver is simple.  Its decisions use saved phases on variables
+// in the order of their local index and there are no restarts nor clause
+// deletion.  All its learned clauses are RUP with respect to the loaded
+// clauses and previously learned clauses.  Thus they are added to the
+// proof and deleted again after the neighborhood is done.  The derived
+// units and binary clauses are RUP from those.
+
+/*------------------------------------------------------------------------*/
+
+struct Sweeper {
+
+  static const unsigned invalid = UINT_MAX;
+
+  Internal * internal;
+
+  vector<int> vars;                   // map local to internal variables
+  vector<unsigned> map;               // map internal to local variables
+  vector<unsigned> arena;             // clauses as size and literals
+  vector<vector<unsigned>> watches;   // per local literal
+
+  vector<signed char> vals;           // per local literal
+  vector<signed char> phases;         // per local variable
+  vector<unsigned> levels;            // per local variable
+  vector<unsigned> reasons;           // per local variable
+  vector<char> seen;                  // per local variable
+
+  vector<unsigned> trail;
+  vector<size_t> control;             // trail height per decision level
+  size_t propagated;
+
+  vector<unsigned> learned;           // conflict analysis result
+  vector<unsigned> analyzed;          // seen variables to reset
+  vector<vector<int>> proof;          // learned clauses traced in proof
+
+  bool inconsistent;                  // root level conflict
+  int64_t ticks;                      // propagation effort
+  int64_t limit;                      // on 'ticks'
+
+  Sweeper (Internal * i, int64_t l) :
+    internal (i), propagated (0), inconsistent (false), ticks (0), limit (l)
+  {
+    map.resize (internal->max_var + 1, invalid);
+  }
+
+  unsigned level () const { return control.size (); }
+
+  int global (unsigned lit) const {
+    const int idx = vars[lit/2];
+    return (lit & 1) ? -idx : idx;
+  }
+
+  unsigned local (int lit) const {
+    const unsigned idx = map[abs (lit)];
+    assert (idx != invalid);
+    return 2*idx + (lit < 0);
+  }
+
+  signed char val (unsigned lit) const { return vals[lit]; }
+
+  unsigned import (int idx) {
+    assert (0 < idx);
+    assert (map[idx] == invalid);
+    const unsigned res = vars.size ();
+    map[idx] = res;
+    vars.push_back (idx);
+    vals.push_back (0), vals.push_back (0);
+    watches.resize (2*vars.size ());
+    phases.push_back (-1);
+    levels.push_back (0);
+    reasons.push_back (invalid);
+    seen.push_back (0);
+    return res;
+  }
+
+  void assign (unsigned lit, unsigned reason) {
+    assert (!val (lit));
+    vals[lit] = 1;
+    vals[lit ^ 1] = -1;
+    levels[lit/2] = level ();
+    reasons[lit/2] = reason;
+    trail.push_back (lit);
+  }
+
+  void backtrack (unsigned new_level) {
+    if (new_level >= level ()) return;
+    const size_t height = control[new_level];
+    while (trail.size () > height) {
+      const unsigned lit = trail.back ();
+      trail.pop_back ();
+      phases[lit/2] = (lit & 1) ? -1 : 1;
+      vals[lit] = vals[lit ^ 1] = 0;
+    }
+    control.resize (new_level);
+    if (propagated > height) propagated = height;
+  }
+
+  void watch (unsigned c) {
+    watches[arena[c + 1]].push_back (c);
+    watches[arena[c + 2]].push_back (c);
+  }
+
+  void add_clause (const vector<unsigned> & lits);
+  unsigned propagate ();
+  void learn (const vector<unsigned> &);
+  bool analyze (unsigned conflict);
+  int solve (const vector<unsigned> & assumptions, int64_t conflicts);
+  void clear ();
+};
+
+const unsigned Sweeper::invalid;
+
+/*------------------------------------------------------------------------*/
+
+// Add an irredundant clause (with root level falsified literals removed).
+
+void Sweeper::add_clause (const vector<unsigned> & lits) {
+  assert (!level ());
+  if (inconsistent) return;
+  if (lits.empty ()) { inconsistent = true; return; }
+  if (lits.size () == 1) {
+    const unsigned lit = lits[0];
+    const signed char tmp = val (lit);
+    if (tmp < 0) inconsistent = true;
+    else if (!tmp) assign (lit, invalid);
+    return;
+  }
+  const unsigned c = arena.size ();
+  arena.push_back (lits.size ());
+  for (const auto & lit : lits) arena.push_back (lit);
+  watch (c);
+}
+
+// Standard propagation with two watched literals, where the watched
+// literals are kept as the first two literals of a clause.
+
+unsigned Sweeper::propagate () {
+  unsigned conflict = invalid;
+  while (conflict == invalid && propagated < trail.size ()) {
+    const unsigned not_lit = trail[propagated++] ^ 1;
+    vector<unsigned> & ws = watches[not_lit];
+    const auto end = ws.end ();
+    auto i = ws.begin (), j = i;
+    while (i != end) {
+      const unsigned c = *j++ = *i++;
+      ticks++;
+      unsigned * lits = &arena[c + 1];
+      const unsigned size = arena[c];
+      if (lits[0] == not_lit) swap (lits[0], lits[1]);
+      assert (lits[1] == not_lit);
+      const signed char other = val (lits[0]);
+      if (other > 0) continue;
+      unsigned k;
+      for (k = 2; k < size; k++)
+        if (val (lits[k]) >= 0) break;
+      if (k < size) {
+        swap (lits[1], lits[k]);
+        watches[lits[1]].push_back (c);
+        j--;
+      } else if (other < 0) {
+        conflict = c;
+        break;
+      } else assign (lits[0], c);
+    }
+    while (i != end) *j++ = *i++;
+    ws.resize (j - ws.begin ());
+  }
+  return conflict;
+}
+
+// Learned units are backbones of the whole formula and are assigned in the
+// main solver too, which also traces them.  Other learned clauses are kept
+// locally and traced in the proof until the sub-solver is cleared.
+
+void Sweeper::learn (const vector<unsigned> & lits) {
+  if (lits.size () == 1) {
+    const unsigned lit = lits[0];
+    backtrack (0);
+    assign (lit, invalid);
+    const int ilit = global (lit);
+    if (!internal->val (ilit)) {
+      LOG ("learned unit %d", ilit);
+      internal->stats.sweepunits++;
+      internal->assign_unit (ilit);
+    }
+    return;
+  }
+  if (internal->proof) {
+    vector<int> clause;
+    for (const auto & lit : lits)
+      clause.push_back (global (lit));
+    internal->proof->add_derived_clause (clause);
+    proof.push_back (clause);
+  }
+  const unsigned c = arena.size ();
+  arena.push_back (lits.size ());
+  for (const auto & lit : lits) arena.push_back (lit);
+  watch (c);
+  backtrack (levels[lits[1]/2]);
+  assign (lits[0], c);
+}
+
+// First unique implication point conflict analysis without minimization.
+// Returns 'false' if the conflict is on the root level.
+
+bool Sweeper::analyze (unsigned conflict) {
+  if (!level ()) return false;
+  learned.clear ();
+  learned.push_back (invalid);
+  unsigned open = 0, uip = invalid;
+  size_t i = trail.size ();
+  unsigned reason = conflict;
+  for (;;) {
+    const unsigned size = arena[reason];
+    const unsigned * lits = &arena[reason + 1];
+    for (unsigned k = 0; k < size; k++) {
+      const unsigned lit = lits[k];
+      const unsigned idx = lit/2;
+      if (seen[idx] || !levels[idx]) continue;
+      seen[idx] = 1;
+      analyzed.push_back (idx);
+      if (levels[idx] == level ()) open++;
+      else learned.push_back (lit);
+    }
+    do {
+      assert (i > 0);
+      uip = trail[--i];
+    } while (!seen[uip/2]);
+    if (!--open) break;
+    reason = reasons[uip/2];
+    assert (reason != invalid);
+  }
+  learned[0] = uip ^ 1;
+  for (const auto & idx : analyzed) seen[idx] = 0;
+  analyzed.clear ();
+
+  // Move literal with highest level to the second position.
+  //
+  for (size_t k = 2; k < learned.size (); k++)
+    if (levels[learned[k]/2] > levels[learned[1]/2])
+      swap (learned[1], learned[k]);
+
+  learn (learned);
+  return true;
+}
+
+// Returns '10' with a model, '20' if unsatisfiable under the assumptions
+// (or inconsistent) and '0' if the conflict or ticks limit is hit.
+
+int Sweeper::solve (const vector<unsigned> & assumptions, int64_t conflicts) {
+  internal->stats.sweepsolved++;
+  backtrack (0);
+  while (!inconsistent) {
+    const unsigned conflict = propagate ();
+    if (conflict != invalid) {
+      if (!analyze (conflict)) { inconsistent = true; break; }
+      if (--conflicts < 0) return 0;
+    } else if (ticks > limit) return 0;
+    else if (level () < assumptions.size ()) {
+      const unsigned lit = assumptions[level ()];
+      const signed char tmp = val (lit);
+      if (tmp < 0) return 20;
+      control.push_back (trail.size ());
+      if (!tmp) assign (lit, invalid);
+    } else {
+      unsigned idx;
+      for (idx = 0; idx < vars.size (); idx++)
+        if (!val (2*idx)) break;
+      if (idx == vars.size ()) return 10;
+      control.push_back (trail.size ());
+      assign (2*idx + (phases[idx] < 0), invalid);
+    }
+  }
+  return 20;
+}
+
+void Sweeper::clear () {
+  backtrack (0);
+  if (internal->proof)
+    for (const auto & clause : proof)
+      internal->proof->delete_clause (clause);
+  for (const auto & idx : vars) map[idx] = invalid;
+  vars.clear ();
+  arena.clear ();
+  watches.clear ();
+  vals.clear ();
+  phases.clear ();
+  levels.clear ();
+  reasons.clear ();
+  seen.clear ();
+  trail.clear ();
+  proof.clear ();
+  propagated = 0;
+  inconsistent = false;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Collect the variables in the neighborhood of 'idx' in breadth first
+// order and load all clauses with only these variables.
+
+void Internal::sweep_environment (Sweeper & sweeper, int idx) {
+
+  sweeper.import (idx);
+
+  size_t begin = 0;
+  for (int depth = 0; depth < opts.sweepdepth; depth++) {
+    const size_t end = sweeper.vars.size ();
+    for (size_t i = begin; i < end; i++) {
+      const int other = sweeper.vars[i];
+      for (int sign = -1; sign <= 1; sign += 2)
+        for (const auto & c : occs (sign * other)) {
+          sweeper.ticks++;
+          if (c->garbage) continue;
+          for (const auto & lit : *c) {
+            if (val (lit)) continue;
+            if (sweeper.map[abs (lit)] != Sweeper::invalid) continue;
+            if ((int) sweeper.vars.size () >= opts.sweepmaxvars) break;
+            sweeper.import (abs (lit));
+          }
+        }
+    }
+    begin = end;
+  }
+
+  // Clauses are added while traversing the occurrences of the variable
+  // with the smallest local index, which avoids adding clauses twice.
+  //
+  vector<unsigned> lits;
+  int64_t added = 0;
+  for (size_t i = 0; i < sweeper.vars.size (); i++) {
+    const int other = sweeper.vars[i];
+    for (int sign = -1; sign <= 1; sign += 2)
+      for (const auto & c : occs (sign * other)) {
+        sweeper.ticks++;
+        if (c->garbage) continue;
+        if (added >= opts.sweepmaxclauses) continue;
+        bool skip = false;
+        lits.clear ();
+        for (const auto & lit : *c) {
+          const signed char tmp = val (lit);
+          if (tmp < 0) continue;
+          if (tmp > 0) { skip = true; break; }
+          const unsigned local = sweeper.map[abs (lit)];
+          if (local == Sweeper::invalid || local < i) { skip = true; break; }
+          lits.push_back (sweeper.local (lit));
+        }
+        if (skip) continue;
+        sweeper.add_clause (lits);
+        added++;
+      }
+  }
+
+  LOG ("sweeping %d with %zd variables and %" PRId64 " clauses",
+    idx, sweeper.vars.size (), added);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Check whether the seed variable 'idx' (local variable zero) is a backbone
+// or equivalent to another literal in its neighborhood.  Returns 'true' if
+// an equivalence was found.
+
+bool Internal::sweep_variable (Sweeper & sweeper, int idx) {
+
+  stats.sweepvars++;
+  sweep_environment (sweeper, idx);
+
+  const int64_t conflicts = opts.sweepconflicts;
+  vector<unsigned> assumptions;
+
+  int res = sweeper.solve (assumptions, conflicts);
+  if (res != 10) {
+    if (sweeper.inconsistent) {
+      LOG ("sweeping %d environment unsatisfiable", idx);
+      learn_empty_clause ();
+    }
+    return false;
+  }
+
+  // Candidate literals equivalent to the seed literal, which is the one
+  // satisfied in the first model, are those satisfied in this model too.
+  //
+  const unsigned seed = sweeper.val (0) < 0;
+  vector<unsigned> candidates;
+  for (unsigned other = 1; other < sweeper.vars.size (); other++)
+    candidates.push_back (2*other + (sweeper.val (2*other) < 0));
+
+  // Remove candidates with a different value than the seed in the current
+  // model of the sub-solver.
+  //
+  auto refine = [&] () {
+    const signed char value = sweeper.val (seed);
+    auto j = candidates.begin ();
+    for (const auto & lit : candidates)
+      if (sweeper.val (lit) == value) *j++ = lit;
+    candidates.resize (j - candidates.begin ());
+  };
+
+  // Backbone check.
+  //
+  assumptions.push_back (seed ^ 1);
+  res = sweeper.solve (assumptions, conflicts);
+  if (res == 10) refine ();
+  else if (res == 20) {
+    if (sweeper.inconsistent) { learn_empty_clause (); return false; }
+    const int unit = sweeper.global (seed);
+    LOG ("sweeping found backbone %d", unit);
+    if (!val (unit)) {
+      stats.sweepunits++;
+      assign_unit (unit);
+    }
+    return false;
+  }
+
+  // Equivalence checks with the remaining candidates.  A model for one of
+  // the two implications removes (at least) the checked candidate.
+  //
+  while (!candidates.empty () && sweeper.ticks <= sweeper.limit) {
+    const unsigned other = candidates[0];
+    assumptions.clear ();
+    assumptions.push_back (seed);
+    assumptions.push_back (other ^ 1);
+    res = sweeper.solve (assumptions, conflicts);
+    if (res == 10) { refine (); continue; }
+    if (res != 20 || sweeper.inconsistent) break;
+    assumptions.clear ();
+    assumptions.push_back (seed ^ 1);
+    assumptions.push_back (other);
+    res = sweeper.solve (assumptions, conflicts);
+    if (res == 10) { refine (); continue; }
+    if (res != 20 || sweeper.inconsistent) break;
+    const int a = sweeper.global (seed);
+    const int b = sweeper.global (other);
+    if (val (a) || val (b)) break;
+    LOG ("sweeping found equivalence %d = %d", a, b);
+    assert (clause.empty ());
+    clause.push_back (-a);
+    clause.push_back (b);
+    new_hyper_binary_resolved_clause (true, 2);
+    clause.clear ();
+    clause.push_back (a);
+    clause.push_back (-b);
+    new_hyper_binary_resolved_clause (true, 2);
+    clause.clear ();
+    stats.sweepequivs++;
+    return true;
+  }
+
+  if (sweeper.inconsistent) learn_empty_clause ();
+  return false;
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::sweep () {
+
+  if (!opts.sweep) return false;
+  if (unsat || terminating ()) return false;
+
+  // Nothing changed since the last completed sweep?
+  //
+  if (!last.sweep.next &&
+      last.sweep.irredundant == stats.added.irredundant) return false;
+
+  assert (!level);
+  assert (watching ());
+
+  START_SIMPLIFIER (sweep, SWEEP);
+  stats.sweep++;
+
+  int64_t limit = stats.propagations.search;
+  limit *= 1e-3 * opts.sweepreleff;
+  if (limit < opts.sweepmineff) limit = opts.sweepmineff;
+  if (limit > opts.sweepmaxeff) limit = opts.sweepmaxeff;
+
+  init_occs ();
+  for (const auto & c : clauses) {
+    if (c->garbage || c->redundant) continue;
+    for (const auto & lit : *c)
+      if (active (lit))
+        occs (lit).push_back (c);
+  }
+
+  const int64_t old_units = stats.sweepunits;
+  const int64_t old_equivs = stats.sweepequivs;
+
+  Sweeper sweeper (this, limit);
+
+  int idx = last.sweep.next;
+  if (idx < 1 || idx > max_var) idx = 1;
+  int swept = 0;
+
+  while (!unsat && !terminating () && swept < max_var) {
+    if (sweeper.ticks > sweeper.limit) break;
+    swept++;
+    if (active (idx)) {
+      sweep_variable (sweeper, idx);
+      sweeper.clear ();
+      if (!unsat && !propagate ()) learn_empty_clause ();
+    }
+    if (++idx > max_var) idx = 1;
+  }
+
+  if (swept == max_var) {
+    last.sweep.next = 0;
+    last.sweep.irredundant = stats.added.irredundant;
+  } else last.sweep.next = idx;
+
+  reset_occs ();
+
+  const int64_t units = stats.sweepunits - old_units;
+  const int64_t equivs = stats.sweepequivs - old_equivs;
+
+  PHASE ("sweep", stats.sweep,
+    "swept %d variables and found %" PRId64 " units and %" PRId64
+    " equivalences", swept, units, equivs);
+
+  STOP_SIMPLIFIER (sweep, SWEEP);
+  report ('=', !opts.reportall && !(units + equivs));
+
+  return !unsat && equivs > 0;
+}
+
+}
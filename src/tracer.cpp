@@ -18,6 +18,14 @@ Tracer::~Tracer () {
   delete file;
 }
 
+// The buffer of the underlying 'FILE' is allocated by the C library and
+// thus its size is only estimated by 'BUFSIZ'.
+
+void Tracer::memory_usage (Bytes & bytes) const {
+  const size_t tracer_bytes = sizeof *this + sizeof *file;
+  bytes.add (tracer_bytes, tracer_bytes + BUFSIZ);
+}
+
 /*------------------------------------------------------------------------*/
 
 // Support for binary DRAT format.
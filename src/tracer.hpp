@@ -7,6 +7,8 @@
 
 namespace CaDiCaL {
 
+struct Bytes;
+
 class Tracer : public Observer {
   Internal * internal;
   File * file;
@@ -24,6 +26,8 @@ public:
   bool closed ();
   void close ();
   void flush ();
+
+  void memory_usage (Bytes &) const;    // Used and reserved bytes.
 };
 
 }
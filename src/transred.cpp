@@ -58,10 +58,13 @@ void Internal::transred () {
     i = clauses.begin ();
   }
 
-  // Move watches of binary clauses to the front. Thus we can stop iterating
-  // watches as soon a long clause is found during watch traversal.
+  // The search only reads the binary implication graph, which does not
+  // change except for clauses becoming garbage (checked below).  Thus we
+  // traverse a CSR snapshot instead of the watches, which also avoids
+  // sorting the watches to move binary clauses to the front.
   //
-  sort_watches ();
+  BinGraph graph;
+  init_bin_graph (graph);
 
   // This working stack plays the same role as the 'trail' during standard
   // propagation.
@@ -96,7 +99,7 @@ void Internal::transred () {
     int src = -c->literals[0];
     int dst = c->literals[1];
     if (val (src) || val (dst)) continue;
-    if (watches (-src).size () < watches (dst).size ()) {
+    if (graph.size (vlit (src)) < graph.size (vlit (-dst))) {
       int tmp = dst;
       dst = -src; src = -tmp;
     }
@@ -124,17 +127,15 @@ void Internal::transred () {
       assert (marked (lit) > 0);
       LOG ("transred propagating %d", lit);
       propagations++;
-      const Watches & ws = watches (-lit);
-      const const_watch_iterator eow = ws.end ();
-      const_watch_iterator k;
-      for (k = ws.begin (); !transitive && !failed && k != eow; k++) {
-        const Watch & w = *k;
-        if (!w.binary ()) break;        // since we sorted watches above
-        Clause * d = w.clause;
+      const unsigned u = vlit (lit);
+      const Bin * eoe = graph.end (u);
+      const Bin * k;
+      for (k = graph.begin (u); !transitive && !failed && k != eoe; k++) {
+        Clause * d = k->clause;
         if (d == c) continue;
         if (irredundant && d->redundant) continue;
         if (d->garbage) continue;
-        const int other = w.blit;
+        const int other = k->lit;
         if (other == dst) transitive = true;    // 'dst' reached
         else {
           const int tmp = marked (other);
@@ -180,6 +181,7 @@ void Internal::transred () {
   last.transred.propagations = stats.propagations.search;
   stats.propagations.transred += propagations;
   erase_vector (work);
+  graph.erase ();
 
   PHASE ("transred", stats.transreds,
     "removed %" PRId64 " transitive clauses, found %d units",
@@ -0,0 +1,352 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Unhiding redundancies through time stamping of the binary implication
+// graph (BIG) following our SAT'11 paper 'Efficient CNF Simplification
+// based on Binary Implication Graphs'.  A randomized depth first search
+// over the irredundant binary clauses assigns each literal a discovery
+// and a finish time.  If the interval of 'v' is nested in the interval of
+// 'u' then 'v' is reachable from 'u' and thus 'u' implies 'v'.  This gives
+// in linear time (and the time needed to sort clauses by stamps):
+//
+//   failed literals: 'u' implies '-u' and thus '-u' is a unit,
+//
+//   hidden tautologies: '-l' implies 'k' for two literals 'l' and 'k' in a
+//   clause, which then is implied by the binary clauses and removed,
+//
+//   hidden literals: 'l' implies another literal 'k' in the clause, which
+//   then can be strengthened by removing 'l'.
+//
+// All three are equivalence preserving and all derived clauses are RUP
+// along the implication chain, so neither witnesses on the extension stack
+// nor anything beyond adding and deleting clauses in the proof is needed.
+//
+// The stamps only provide a sufficient condition for reachability, which
+// is sound even if the BIG has cycles.  Binary clauses are however only
+// removed as hidden tautologies (i.e., transitive edges) if the search did
+// not find a cycle, since otherwise the alternative path could use the
+// clause itself.  Each round starts from roots in a different random order,
+// which gives a different forest and thus finds different redundancies.
+//
+// As 'transred' and 'vivify', unhiding is bounded relative to the number
+// of search propagations since the last time it ran.  The stamping work
+// (visited literals and edges) and the literals of checked clauses are
+// counted as 'ticks'.  Rounds are stopped (also in the middle of checking
+// clauses) as soon as the limit is hit.
+
+struct Stamp {
+  unsigned dsc, fin;    // discovery and finish time
+  int parent;           // parent literal in the depth first search tree
+};
+
+struct unhide_less_dsc {
+
+  Internal * internal;
+  const Stamp * stamps;
+
+  unhide_less_dsc (Internal * i, const Stamp * s) :
+    internal (i), stamps (s) { }
+
+  bool operator () (int a, int b) const {
+    return stamps[internal->vlit (a)].dsc < stamps[internal->vlit (b)].dsc;
+  }
+};
+
+// Is 'v' a proper descendant of 'u' in the depth first search forest?
+
+inline static bool
+unhide_implies (const Stamp & u, const Stamp & v) {
+  return u.dsc < v.dsc && v.fin < u.fin;
+}
+
+inline static void unhide_shuffle (vector<int> & lits, Random & random) {
+  for (int i = (int) lits.size () - 1; i > 0; i--)
+    swap (lits[i], lits[random.pick_int (0, i)]);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Stamp all literals with discovery and finish times.  The search starts
+// from roots (literals without incoming edges) first and then all other
+// literals, both in random order.  Returns whether a back edge and thus a
+// cycle was found.  Stamping always runs to completion and its work is
+// added to 'ticks'.
+
+bool Internal::unhide_stamp (const BinGraph & graph, Stamp * stamps,
+                             Random & random, int64_t & ticks) {
+
+  vector<int> roots, others;
+  for (int idx = 1; idx <= max_var; idx++) {
+    if (!active (idx)) continue;
+    for (int lit = -idx; lit <= idx; lit += 2*idx)
+      if (graph.size (vlit (-lit))) others.push_back (lit);
+      else roots.push_back (lit);
+  }
+
+  unhide_shuffle (roots, random);
+  unhide_shuffle (others, random);
+  roots.insert (roots.end (), others.begin (), others.end ());
+  erase_vector (others);
+  ticks += roots.size ();
+
+  vector<int> work;
+  unsigned stamp = 0;
+  bool cyclic = false;
+
+  for (const auto & root : roots) {
+    if (stamps[vlit (root)].dsc) continue;
+    stamps[vlit (root)].parent = 0;
+    work.push_back (root);
+    while (!work.empty ()) {
+      const int lit = work.back ();
+      Stamp & s = stamps[vlit (lit)];
+      if (!s.dsc) {
+        s.dsc = ++stamp;
+        ticks += 1 + graph.size (vlit (lit));
+        const Bin * const eob = graph.end (vlit (lit));
+        for (const Bin * k = graph.begin (vlit (lit)); k != eob; k++) {
+          const int child = k->lit;
+          Stamp & t = stamps[vlit (child)];
+          if (!t.dsc) {
+            t.parent = lit;             // last push is discovered first
+            work.push_back (child);
+          } else if (!t.fin) cyclic = true;
+        }
+      } else {
+        work.pop_back ();
+        if (!s.fin) s.fin = ++stamp;
+      }
+    }
+  }
+
+  LOG ("stamped %u times %s cycles", stamp, cyclic ? "with" : "without");
+
+  return cyclic;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Check whether '-l' implies 'k' for two literals 'l' and 'k' in the
+// clause.  Merging the literals and their negations both sorted by
+// discovery time makes this linear (after sorting).
+
+bool Internal::unhide_hidden_tautology (Clause * c, const Stamp * stamps,
+                                        bool cyclic) {
+  const bool binary = (c->size == 2);
+  if (binary && cyclic) return false;
+
+  vector<int> & pos = clause;
+  vector<int> neg;
+  assert (pos.empty ());
+  for (const auto & lit : *c) {
+    pos.push_back (lit);
+    neg.push_back (-lit);
+  }
+
+  unhide_less_dsc less (this, stamps);
+  sort (pos.begin (), pos.end (), less);
+  sort (neg.begin (), neg.end (), less);
+
+  const size_t size = pos.size ();
+  size_t i = 0, j = 0;
+  bool res = false;
+
+  for (;;) {
+    const int n = neg[i], p = pos[j];
+    const Stamp & s = stamps[vlit (n)], & t = stamps[vlit (p)];
+    if (s.dsc > t.dsc) {
+      if (++j == size) break;
+    } else if (t.fin < s.fin &&
+               (!binary || (p != -n && t.parent != n))) {
+      res = true;
+      break;
+    } else if (++i == size) break;
+  }
+
+  pos.clear ();
+
+  return res;
+}
+
+// Find literals 'l' in the clause which imply another literal 'k' in the
+// clause.  First check nested intervals of the literals, by traversing
+// them in reverse discovery order.  Then check nested intervals of their
+// negations, i.e., '-k' implies '-l', in discovery order.  Witnesses are
+// only taken from literals which are kept.
+
+void Internal::unhide_hidden_literals (Clause * c, const Stamp * stamps,
+                                       vector<int> & removed) {
+  assert (removed.empty ());
+
+  vector<int> & lits = clause;
+  assert (lits.empty ());
+  for (const auto & lit : *c) lits.push_back (lit);
+
+  unhide_less_dsc less (this, stamps);
+  sort (lits.begin (), lits.end (), less);
+
+  unsigned finished = UINT_MAX;
+  auto j = lits.rbegin ();
+  for (auto i = j; i != lits.rend (); i++) {
+    const int lit = *i;
+    const unsigned fin = stamps[vlit (lit)].fin;
+    if (fin > finished) removed.push_back (lit);
+    else { finished = fin; *j++ = lit; }
+  }
+  lits.erase (lits.begin (), j.base ());
+
+  for (auto & lit : lits) lit = -lit;
+  sort (lits.begin (), lits.end (), less);
+
+  finished = 0;
+  for (const auto & lit : lits) {
+    const unsigned fin = stamps[vlit (lit)].fin;
+    if (fin < finished) removed.push_back (-lit);
+    else finished = fin;
+  }
+
+  lits.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::unhide_round (int round, int64_t & ticks, int64_t limit) {
+
+  stats.unhiderounds++;
+
+  BinGraph graph;
+  init_bin_graph (graph, true);
+
+  const size_t size = 2*(max_var + 1);
+  Stamp * stamps = new Stamp[size];
+  memset (stamps, 0, size * sizeof *stamps);
+
+  Random random (opts.seed);
+  random += stats.unhiderounds;
+
+  const bool cyclic = unhide_stamp (graph, stamps, random, ticks);
+
+  // Failed literals which imply their negation.
+
+  int64_t units = 0;
+  for (int idx = 1; !unsat && idx <= max_var; idx++) {
+    if (!active (idx)) continue;
+    for (int lit = -idx; !unsat && lit <= idx; lit += 2*idx) {
+      if (val (lit)) continue;
+      if (!unhide_implies (stamps[vlit (lit)], stamps[vlit (-lit)]))
+        continue;
+      LOG ("unhidden failed literal %d", lit);
+      units++;
+      stats.failed++;
+      assign_unit (-lit);
+      if (!propagate ()) {
+        LOG ("propagating unhidden unit results in conflict");
+        learn_empty_clause ();
+      }
+    }
+  }
+  stats.unhideunits += units;
+
+  // Then hidden tautologies and hidden literals with the watches reset,
+  // since strengthening might remove watched literals.
+
+  int64_t tautologies = 0, strengthened = 0;
+
+  if (!unsat) {
+
+    reset_watches ();
+
+    vector<int> removed;
+    const size_t clauses_size = clauses.size ();
+    for (size_t i = 0; !terminating () && i < clauses_size; i++) {
+      if (ticks > limit) break;
+      Clause * c = clauses[i];
+      if (c->garbage) continue;
+      ticks += 1 + c->size;
+      bool assigned = false;
+      for (const auto & lit : *c)
+        if (val (lit)) { assigned = true; break; }
+      if (assigned) continue;
+      if (unhide_hidden_tautology (c, stamps, cyclic)) {
+        LOG (c, "unhidden tautology");
+        tautologies++;
+        mark_garbage (c);
+        continue;
+      }
+      if (c->size == 2) continue;
+      unhide_hidden_literals (c, stamps, removed);
+      for (const auto & lit : removed) {
+        if (c->size == 2) break;
+        LOG (c, "unhidden literal %d in", lit);
+        strengthened++;
+        strengthen_clause (c, lit);
+      }
+      removed.clear ();
+    }
+
+    init_watches ();
+    connect_watches ();
+    if (!propagate ()) {
+      LOG ("propagation after unhiding results in inconsistency");
+      learn_empty_clause ();
+    }
+  }
+
+  stats.unhidetauts += tautologies;
+  stats.unhidestrs += strengthened;
+
+  delete [] stamps;
+  graph.erase ();
+
+  PHASE ("unhide-round", stats.unhiderounds,
+    "round %d found %" PRId64 " units %" PRId64 " hidden tautologies "
+    "and %" PRId64 " hidden literals", round, units, tautologies,
+    strengthened);
+
+  return !unsat && (units + tautologies + strengthened);
+}
+
+void Internal::unhide () {
+
+  if (unsat || terminating ()) return;
+  if (!stats.current.irredundant) return;
+
+  assert (opts.unhide);
+  assert (opts.simplify);
+  assert (!level);
+
+  START_SIMPLIFIER (unhide, UNHIDE);
+  stats.unhides++;
+
+  int64_t limit = stats.propagations.search;
+  limit -= last.unhide.propagations;
+  limit *= 1e-3 * opts.unhidereleff;
+  if (limit < opts.unhidemineff) limit = opts.unhidemineff;
+  if (limit > opts.unhidemaxeff) limit = opts.unhidemaxeff;
+
+  PHASE ("unhide", stats.unhides,
+    "unhiding limit of %" PRId64 " ticks", limit);
+
+  const int64_t before = stats.unhidetauts + stats.unhidestrs +
+                         stats.unhideunits;
+
+  int64_t ticks = 0;
+  for (int round = 1; round <= opts.unhiderounds; round++)
+    if (terminating () || ticks > limit ||
+        !unhide_round (round, ticks, limit))
+      break;
+
+  last.unhide.propagations = stats.propagations.search;
+  stats.unhideticks += ticks;
+
+  const int64_t found = stats.unhidetauts + stats.unhidestrs +
+                        stats.unhideunits - before;
+
+  STOP_SIMPLIFIER (unhide, UNHIDE);
+  report ('u', !opts.reportall && !found);
+}
+
+}
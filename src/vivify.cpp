@@ -36,6 +36,14 @@ namespace CaDiCaL {
 // literals in all clauses with respect to that order.  We favor literals
 // with more occurrences first.  Then we sort clauses lexicographically with
 // respect to that literal order.
+//
+// Since the schedule is primarily sorted by glue and size, clauses sharing
+// a prefix but differing in size or glue used to be far apart.  Thus the
+// schedule is further cut into batches of 'vivifytrie' candidates, which
+// are sorted purely lexicographically.  Within a batch the candidates are
+// then traversed in the depth first order of the (implicit) prefix trie,
+// which means that the decisions and propagations of a shared prefix are
+// performed once for all its descendants before backtracking.
 
 /*------------------------------------------------------------------------*/
 
@@ -230,6 +238,27 @@ struct vivify_more_noccs {
 // This order is defined by 'vivify_clause_later' which returns 'true' if
 // the first clause should be vivified later than the second.
 
+// Pure lexicographic order with respect to 'vivify_more_noccs' assuming
+// literals in clauses are sorted decreasingly with respect to that order,
+// i.e., the depth first order of the prefix trie of the clauses.  Again
+// the first clause to be tried should be last.
+
+struct vivify_prefix_later {
+
+  Internal * internal;
+
+  vivify_prefix_later (Internal * i) : internal (i) { }
+
+  bool operator () (Clause * a, Clause * b) const {
+    const auto eoa = a->end (), eob = b->end ();
+    auto j = b->begin ();
+    for (auto i = a->begin (); i != eoa && j != eob; i++, j++)
+      if (*i != *j) return vivify_more_noccs (internal) (*j, *i);
+
+    return j == eob;    // Prefer shorter clauses to be vivified first.
+  }
+};
+
 struct vivify_clause_later {
 
   Internal * internal;
@@ -258,15 +287,9 @@ struct vivify_clause_later {
     if (a->size < b->size) return false;
 
     // Now compare literals in the clauses lexicographically with respect to
-    // the literal order 'vivify_more_noccs' assuming literals are sorted
-    // decreasingly with respect to that order.
+    // the literal order 'vivify_more_noccs'.
     //
-    const auto eoa = a->end (), eob = b->end ();
-    auto j = b->begin ();
-    for (auto i = a->begin (); i != eoa && j != eob; i++, j++)
-      if (*i != *j) return vivify_more_noccs (internal) (*j, *i);
-
-    return j == eob;    // Prefer shorter clauses to be vivified first.
+    return vivify_prefix_later (internal) (a, b);
   }
 };
 
@@ -646,6 +669,10 @@ void Internal::vivify_clause (Vivifier & vivifier, Clause * c) {
     }
 
     LOG ("reused %d decision levels from %d", level, orig_level);
+
+    // Count the propagated literals on the reused levels too.
+    //
+    if (level) stats.vivifysaved += trail.size () - control[1].trail;
   }
 
   LOG (sorted, "sorted size %zd probing schedule", sorted.size ());
@@ -862,6 +889,473 @@ void Internal::vivify_clause (Vivifier & vivifier, Clause * c) {
 
 /*------------------------------------------------------------------------*/
 
+// Parallel vivification checks segments of the schedule with worker
+// threads.  Each worker has its own assignment, trail and watches, which
+// are initialized lazily from a snapshot of the clauses taken at the
+// start of the round.  The shared clauses are only read, i.e., literals
+// are not moved during watch replacement and the watched literals of a
+// clause are kept in the worker.  Root level values are read from the
+// (then idle) main solver, which is at decision level zero during the
+// parallel phase.  Clauses which became garbage are skipped.  Clauses
+// added during the round are not seen by the workers, which only makes
+// their propagation weaker but not unsound.
+//
+// The candidates of a segment are split into tasks of a fixed number of
+// consecutive candidates.  Within a task decisions are reused as in the
+// sequential version (and segments are trie batches, see 'vivifytrie').
+// For each candidate the worker records the outcome together with all
+// clauses used to derive it ('antecedents').  The main thread then goes
+// over the candidates of the segment in schedule order.  If an antecedent
+// was removed or replaced in the mean time, the result might depend on a
+// clause which in turn was vivified with the help of this candidate, and
+// the candidate is checked again sequentially.  Otherwise the result is
+// applied, which adds and deletes clauses in the proof as before.  Since
+// the tasks handed out to a worker only depend on the number of workers,
+// the result is deterministic for a given number of threads.
+
+struct VivifyWatch {
+  Clause * clause;
+  int blit;
+  unsigned idx;         // position of clause in snapshot
+};
+
+struct VivifyResult {
+  enum { NONE = 0, SATISFIED = 1, SUBSUMED = 2, STRENGTHENED = 3 };
+  signed char kind;
+  signed char stred;    // strengthened in redundant mode case (1-3)
+  vector<int> literals;
+  vector<Clause *> antecedents;
+  int64_t decisions, reused, saved;
+  VivifyResult () :
+    kind (NONE), stred (0), decisions (0), reused (0), saved (0) { }
+};
+
+struct VivifyWorker {
+
+  static const size_t task = 64;        // candidates per task
+
+  Internal * internal;
+  bool redundant_mode;
+  bool initialized;
+
+  vector<signed char> vals;             // private assignment by 'vlit'
+  vector<int> levels;                   // by variable index
+  vector<Clause *> reasons;             // by variable index
+  vector<signed char> seen;             // by variable index
+  vector<int> trail;
+  vector<size_t> control;               // trail start of decision levels
+  size_t propagated;
+
+  vector<vector<VivifyWatch>> watches;  // by 'vlit'
+  vector<int> watched;                  // two literals per clause
+
+  vector<int> sorted, analyzed;
+  vector<Clause *> stack;
+  Clause * ignore, * conflict;
+  int64_t propagations;
+
+  VivifyWorker (Internal * i, bool mode) :
+    internal (i), redundant_mode (mode), initialized (false),
+    propagated (0), ignore (0), conflict (0), propagations (0)
+  { }
+
+  unsigned vlit (int lit) const { return internal->vlit (lit); }
+
+  int level () const { return (int) control.size (); }
+
+  signed char val (int lit) const {
+    const signed char res = internal->val (lit);    // root level
+    return res ? res : vals[vlit (lit)];
+  }
+
+  void init (const vector<Clause *> & snapshot);
+  void assign (int lit, Clause * reason);
+  void assume (int lit);
+  void backtrack (int new_level);
+  bool propagate ();
+  void analyze (Clause * start, VivifyResult &, bool & only_binary);
+  bool all_decisions (Clause * c, int subsume);
+  void post_process (Clause * c, int subsume, VivifyResult &);
+  void vivify (Clause * c, VivifyResult &);
+};
+
+void VivifyWorker::init (const vector<Clause *> & snapshot) {
+  assert (!initialized);
+  initialized = true;
+  const size_t vsize = internal->max_var + 1;
+  vals.resize (2*vsize, 0);
+  levels.resize (vsize, 0);
+  reasons.resize (vsize, 0);
+  seen.resize (vsize, 0);
+  watches.resize (2*vsize);
+  watched.resize (2*snapshot.size (), 0);
+  for (size_t i = 0; i < snapshot.size (); i++) {
+    Clause * c = snapshot[i];
+    if (c->garbage) continue;
+    int lits[2], found = 0;
+    bool satisfied = false;
+    for (const auto & lit : *c) {
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0) { satisfied = true; break; }
+      if (tmp < 0) continue;
+      if (found < 2) lits[found++] = lit;
+    }
+    if (satisfied || found < 2) continue;
+    watched[2*i] = lits[0];
+    watched[2*i + 1] = lits[1];
+    watches[vlit (lits[0])].push_back ({ c, lits[1], (unsigned) i });
+    watches[vlit (lits[1])].push_back ({ c, lits[0], (unsigned) i });
+  }
+}
+
+inline void VivifyWorker::assign (int lit, Clause * reason) {
+  const int idx = abs (lit);
+  assert (!val (lit));
+  vals[vlit (lit)] = 1;
+  vals[vlit (-lit)] = -1;
+  levels[idx] = level ();
+  reasons[idx] = reason;
+  trail.push_back (lit);
+}
+
+void VivifyWorker::assume (int lit) {
+  control.push_back (trail.size ());
+  assign (lit, 0);
+}
+
+void VivifyWorker::backtrack (int new_level) {
+  assert (new_level <= level ());
+  if (new_level == level ()) return;
+  const size_t start = control[new_level];
+  control.resize (new_level);
+  while (trail.size () > start) {
+    const int lit = trail.back ();
+    trail.pop_back ();
+    vals[vlit (lit)] = vals[vlit (-lit)] = 0;
+  }
+  if (propagated > start) propagated = start;
+}
+
+// Same as 'vivify_propagate' except that watched literals are kept in the
+// worker instead of the first two literals of the clause.
+
+bool VivifyWorker::propagate () {
+  assert (!conflict);
+  while (!conflict && propagated < trail.size ()) {
+    const int lit = -trail[propagated++];
+    propagations++;
+    auto & ws = watches[vlit (lit)];
+    const auto eow = ws.end ();
+    auto i = ws.begin (), j = i;
+    while (i != eow) {
+      const VivifyWatch w = *j++ = *i++;
+      if (val (w.blit) > 0) continue;
+      Clause * c = w.clause;
+      if (c == ignore || c->garbage) continue;
+      int * lits = &watched[2*w.idx];
+      const int other = lits[0] ^ lits[1] ^ lit;
+      const signed char u = val (other);
+      if (u > 0) { j[-1].blit = other; continue; }
+      int replacement = 0;
+      for (const auto & k : *c) {
+        if (k == lit || k == other) continue;
+        if (val (k) < 0) continue;
+        replacement = k;
+        break;
+      }
+      if (replacement) {
+        if (lits[0] == lit) lits[0] = replacement;
+        else lits[1] = replacement;
+        watches[vlit (replacement)].push_back ({ c, other, w.idx });
+        j--;
+      } else if (!u) assign (other, c);
+      else { conflict = c; break; }
+    }
+    if (j != i) {
+      while (i != eow) *j++ = *i++;
+      ws.resize (j - ws.begin ());
+    }
+  }
+  return !conflict;
+}
+
+// Same as 'vivify_analyze_redundant' but also collects the clauses used.
+
+void VivifyWorker::analyze (Clause * start, VivifyResult & res,
+                            bool & only_binary) {
+  only_binary = true;
+  stack.clear ();
+  stack.push_back (start);
+  while (!stack.empty ()) {
+    Clause * c = stack.back ();
+    stack.pop_back ();
+    res.antecedents.push_back (c);
+    if (c->size > 2) only_binary = false;
+    for (const auto & lit : *c) {
+      if (internal->val (lit)) continue;        // root level
+      const int idx = abs (lit);
+      if (seen[idx]) continue;
+      assert (val (lit) < 0);
+      seen[idx] = 1;
+      analyzed.push_back (idx);
+      if (reasons[idx]) stack.push_back (reasons[idx]);
+    }
+  }
+}
+
+// See 'vivify_all_decisions' and 'vivify_post_process_analysis'.
+
+bool VivifyWorker::all_decisions (Clause * c, int subsume) {
+  for (const auto & other : *c) {
+    if (other == subsume) continue;
+    if (val (other) >= 0) return false;
+    if (internal->val (other)) continue;
+    const int idx = abs (other);
+    if (reasons[idx]) return false;
+    if (!seen[idx]) return false;
+  }
+  return true;
+}
+
+void VivifyWorker::post_process (Clause * c, int subsume,
+                                 VivifyResult & res) {
+  if (all_decisions (c, subsume)) return;
+  for (const auto & other : *c) {
+    bool keep;
+    if (other == subsume) keep = true;
+    else if (val (other) >= 0) keep = false;
+    else if (internal->val (other)) keep = false;
+    else if (reasons[abs (other)]) keep = false;
+    else keep = seen[abs (other)];
+    if (keep) res.literals.push_back (other);
+  }
+}
+
+// Read-only version of 'vivify_clause' (see comments there).
+
+void VivifyWorker::vivify (Clause * c, VivifyResult & res) {
+
+  if (c->garbage) return;
+
+  sorted.clear ();
+  for (const auto & lit : *c) {
+    const signed char tmp = internal->val (lit);
+    if (tmp > 0) { res.kind = VivifyResult::SATISFIED; return; }
+    if (!tmp) sorted.push_back (lit);
+  }
+
+  sort (sorted.begin (), sorted.end (), vivify_more_noccs (internal));
+
+  if (level ()) {
+    int forced = 0;
+    for (const auto & lit : *c) {
+      const signed char tmp = val (lit);
+      if (tmp < 0) continue;
+      if (tmp > 0 && reasons[abs (lit)] == c) forced = lit;
+      break;
+    }
+    if (forced) backtrack (levels[abs (forced)] - 1);
+    int l = 0;
+    for (const auto & lit : sorted) {
+      if (l == level ()) break;
+      if (-lit != trail[control[l]]) { backtrack (l); break; }
+      res.reused++;
+      l++;
+    }
+    if (level ()) res.saved += trail.size () - control[0];
+  }
+
+  ignore = c;
+
+  int subsume = 0, remove = 0;
+  bool only_binary = false;
+
+  for (const auto & lit : sorted) {
+    if (subsume) break;
+    const signed char tmp = val (lit);
+    if (tmp) {
+      const int idx = abs (lit);
+      if (!reasons[idx]) continue;
+      if (tmp > 0) {
+        subsume = lit;
+        seen[idx] = 1;
+        analyzed.push_back (idx);
+        analyze (reasons[idx], res, only_binary);
+        if (redundant_mode && !only_binary) {
+          post_process (c, subsume, res);
+          res.stred = 2;
+        }
+        backtrack (level () - 1);
+        break;
+      } else remove = lit;
+    } else {
+      res.decisions++;
+      assume (-lit);
+      if (propagate ()) continue;
+      subsume = INT_MIN;
+      analyze (conflict, res, only_binary);
+      if (redundant_mode && !only_binary) {
+        post_process (c, subsume, res);
+        res.stred = 3;
+      }
+      backtrack (level () - 1);
+      conflict = 0;
+      break;
+    }
+  }
+
+  ignore = 0;
+
+  if (subsume) {
+    if (redundant_mode && !only_binary) {
+      if (!res.literals.empty ()) res.kind = VivifyResult::STRENGTHENED;
+    } else res.kind = VivifyResult::SUBSUMED;
+  } else if (remove) {
+    assert (res.literals.empty ());
+    for (const auto & other : *c) {
+      assert (val (other) < 0);
+      if (internal->val (other)) continue;
+      const int idx = abs (other);
+      Clause * reason = reasons[idx];
+      if (!reason) { res.literals.push_back (other); continue; }
+      if (seen[idx]) continue;
+      seen[idx] = 1;
+      analyzed.push_back (idx);
+      analyze (reason, res, only_binary);
+    }
+    res.kind = VivifyResult::STRENGTHENED;
+    res.stred = redundant_mode;
+  }
+
+  for (const auto & idx : analyzed) seen[idx] = 0;
+  analyzed.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Apply the result of a worker for candidate 'c' in the main thread.
+
+void Internal::vivify_apply_result (Vivifier & vivifier, Clause * c,
+                                    VivifyResult & res) {
+  assert (!level);
+
+  if (c->garbage) { c->vivify = false; c->vivified = true; return; }
+
+  for (const auto & d : res.antecedents) {
+    if (!d->garbage) continue;
+    LOG (c, "antecedent removed thus vivifying sequentially");
+    stats.vivifyrechecks++;
+    vivify_clause (vivifier, c);
+    if (level) backtrack ();
+    return;
+  }
+
+  c->vivify = false;
+  c->vivified = true;
+  stats.vivifychecks++;
+  stats.vivifydecs += res.decisions;
+  stats.vivifyreused += res.reused;
+  stats.vivifysaved += res.saved;
+
+  if (res.kind == VivifyResult::SATISFIED) {
+    LOG (c, "satisfied by propagated unit");
+    mark_garbage (c);
+  } else if (res.kind == VivifyResult::SUBSUMED) {
+    stats.vivifysubs++;
+    LOG (c, "redundant asymmetric tautology");
+    mark_garbage (c);
+  } else if (res.kind == VivifyResult::STRENGTHENED) {
+    assert (clause.empty ());
+    bool satisfied = false;
+    for (const auto & lit : res.literals) {
+      const signed char tmp = val (lit);
+      if (tmp > 0) satisfied = true;
+      else if (!tmp) clause.push_back (lit);
+    }
+    if (satisfied) {
+      LOG (c, "satisfied by propagated unit");
+      clause.clear ();
+      mark_garbage (c);
+    } else if (clause.empty ()) {
+      LOG (c, "strengthened clause falsified");
+      learn_empty_clause ();
+    } else {
+      if (res.stred == 1) stats.vivifystred1++;
+      else if (res.stred == 2) stats.vivifystred2++;
+      else if (res.stred == 3) stats.vivifystred3++;
+      else stats.vivifystrirr++;
+      vivify_strengthen (c);
+    }
+  } else LOG (c, "vivification failed");
+}
+
+// Parallel version of the main loop of 'vivify_round'.
+
+void Internal::vivify_in_parallel (Vivifier & vivifier, int64_t limit) {
+
+  const bool redundant_mode = vivifier.redundant_mode;
+
+  vector<Clause *> snapshot;
+  for (const auto & c : clauses)
+    if (!c->garbage && (redundant_mode || !c->redundant))
+      snapshot.push_back (c);
+
+  vector<VivifyWorker> workers;
+  vector<Clause *> candidates;
+  vector<VivifyResult> results;
+
+  const size_t segment = opts.vivifytrie ? opts.vivifytrie : 1024;
+  const size_t task = VivifyWorker::task;
+  auto & schedule = vivifier.schedule;
+
+  while (!unsat &&
+         !terminating () &&
+         !schedule.empty () &&
+         stats.propagations.vivify < limit) {
+
+    if (level) backtrack ();
+
+    candidates.clear ();
+    while (!schedule.empty () && candidates.size () < segment) {
+      candidates.push_back (schedule.back ());
+      schedule.pop_back ();
+    }
+
+    const size_t size = candidates.size ();
+    results.clear ();
+    results.resize (size);
+
+    const size_t tasks = (size + task - 1) / task;
+    const unsigned count = parallel_workers (tasks);
+    while (workers.size () < count)
+      workers.push_back (VivifyWorker (this, redundant_mode));
+
+    parallel_for (count, tasks,
+      [&] (unsigned worker, size_t begin, size_t end) {
+        VivifyWorker & w = workers[worker];
+        if (!w.initialized) w.init (snapshot);
+        for (size_t t = begin; t < end; t++) {
+          w.backtrack (0);
+          const size_t last = min (size, (t + 1) * task);
+          for (size_t i = t * task; i < last; i++)
+            w.vivify (candidates[i], results[i]);
+        }
+        w.backtrack (0);
+      });
+
+    stats.vivifyparallel++;
+    for (auto & w : workers) {
+      stats.propagations.vivify += w.propagations;
+      w.propagations = 0;
+    }
+
+    for (size_t i = 0; !unsat && i < size; i++)
+      vivify_apply_result (vivifier, candidates[i], results[i]);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // There are two modes of vivification, one using all clauses and one
 // focusing on irredundant clauses only.  The latter variant working on
 // irredundant clauses only can also remove irredundant asymmetric
@@ -944,6 +1438,22 @@ void Internal::vivify_round (bool redundant_mode, int64_t propagation_limit) {
   stable_sort (vivifier.schedule.begin (), vivifier.schedule.end (),
     vivify_clause_later (this));
 
+  // Then reorder batches of candidates (starting with the first to be
+  // tried at the end) in prefix trie order to share more decisions.
+  //
+  if (opts.vivifytrie) {
+    const auto begin = vivifier.schedule.begin ();
+    const size_t batch = opts.vivifytrie;
+    auto end = vivifier.schedule.end ();
+    while (end != begin) {
+      const size_t size = min ((size_t) (end - begin), batch);
+      const auto start = end - size;
+      stable_sort (start, end, vivify_prefix_later (this));
+      stats.vivifybatches++;
+      end = start;
+    }
+  }
+
   // Remember old values of counters to summarize after each round with
   // verbose messages what happened in that round.
   //
@@ -970,14 +1480,17 @@ void Internal::vivify_round (bool redundant_mode, int64_t propagation_limit) {
     learn_empty_clause ();
   }
 
-  while (!unsat &&
-         !terminating () &&
-         !vivifier.schedule.empty () &&
-         stats.propagations.vivify < limit) {
-    Clause * c = vivifier.schedule.back ();              // Next candidate.
-    vivifier.schedule.pop_back ();
-    vivify_clause (vivifier, c);
-  }
+  if (opts.vivifyparallel && opts.threads > 1)
+    vivify_in_parallel (vivifier, limit);
+  else
+    while (!unsat &&
+           !terminating () &&
+           !vivifier.schedule.empty () &&
+           stats.propagations.vivify < limit) {
+      Clause * c = vivifier.schedule.back ();            // Next candidate.
+      vivifier.schedule.pop_back ();
+      vivify_clause (vivifier, c);
+    }
 
   if (level) backtrack ();
 
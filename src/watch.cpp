@@ -35,6 +35,7 @@ void Internal::connect_watches (bool irredundant_only) {
   for (const auto & c : clauses) {
     if (irredundant_only && c->redundant) continue;
     if (c->garbage || c->size > 2) continue;
+    if (c->card) continue;
     watch_clause (c); // line 426 of internal.hpp
   }
 
@@ -0,0 +1,51 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// Same formula as 'test/cnf/autarky.cnf'.  With the default initial phase
+// '{1,2,3}' is an autarky.  Clauses '1 -3' and '-1 2 -3' are mixed and
+// removed with witness '{1,2,3}', while '1 2', '2 3' and '1 -5' are
+// removed with a single autarky literal as witness.
+static const int formula[] = {
+  1, 2, 0, 2, 3, 0, 1, -3, 0, -1, 2, -3, 0,
+  -5, -6, 0, 5, 6, 0, 1, -5, 0, -4, 5, 0
+};
+static vector<int> clauses;
+static void add (CaDiCaL::Solver & solver, int lit) {
+  clauses.push_back (lit);
+  solver.add (lit);
+}
+static void check (CaDiCaL::Solver & solver) {
+  bool satisfied = false;
+  for (const auto & lit : clauses) {
+    if (!lit) { assert (satisfied); satisfied = false; }
+    else if (solver.val (lit) > 0) satisfied = true;
+  }
+}
+int main () {
+  CaDiCaL::Solver solver;
+  solver.set ("check", 1);
+  for (const auto & lit : formula)
+    add (solver, lit);
+  int res = solver.solve ();
+  cout << "solver.solve () = " << res << endl << flush;
+  assert (res == 10);
+  check (solver);
+  // Falsifies the autarky assignment of '2' and '3', which forces the mixed
+  // clauses to be restored (and '1 2' and '2 3' too).
+  add (solver, -2), add (solver, -3), add (solver, 0);
+  res = solver.solve ();
+  cout << "solver.solve () = " << res << endl << flush;
+  assert (res == 10);
+  check (solver);
+  add (solver, -1), add (solver, 0);
+  add (solver, -2), add (solver, 0);
+  res = solver.solve ();
+  cout << "solver.solve () = " << res << endl << flush;
+  assert (res == 20);
+  return 0;
+}
@@ -0,0 +1,55 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// Pseudo random 3-CNF formula over 'n' variables.
+static void formula (CaDiCaL::Solver & solver, int n, unsigned seed) {
+  for (int i = 0; i < 4*n; i++)
+    for (int j = 0; j < 3; j++) {
+      seed = seed * 1664525u + 1013904223u;
+      int lit = (seed >> 8) % n + 1;
+      seed = seed * 1664525u + 1013904223u;
+      solver.add (((seed >> 12) & 1) ? -lit : lit);
+      if (j == 2) solver.add (0);
+    }
+}
+int main () {
+  const int n = 50;
+  for (unsigned seed = 1; seed <= 20; seed++) {
+    CaDiCaL::Solver solver, checker;
+    formula (solver, n, seed);
+    formula (checker, n, seed);
+    vector<int> lits;
+    int res = solver.backbone (lits, seed & 1);
+    cout << "solver.backbone () = " << res
+         << " with " << lits.size () << " literals" << endl << flush;
+    if (checker.solve () == 20) { assert (res == 20); continue; }
+    assert (res == 10);
+    // Compare against checking each literal individually.
+    size_t count = 0;
+    for (int idx = 1; idx <= n; idx++) {
+      checker.assume (idx);
+      const int pos = checker.solve ();
+      checker.assume (-idx);
+      const int neg = checker.solve ();
+      assert (pos == 10 || neg == 10);
+      if (pos == 10 && neg == 10) continue;
+      const int lit = pos == 10 ? idx : -idx;
+      assert (count < lits.size ());
+      assert (lits[count] == lit);
+      count++;
+    }
+    assert (count == lits.size ());
+    if (seed & 1) for (const auto & lit : lits) assert (solver.fixed (lit) > 0);
+  }
+  // The backbone is empty for formulas without any clause.
+  CaDiCaL::Solver empty;
+  vector<int> lits;
+  assert (empty.backbone (lits) == 10);
+  assert (lits.empty ());
+  return 0;
+}
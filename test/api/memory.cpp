@@ -0,0 +1,32 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+struct Summary : public CaDiCaL::MemoryIterator {
+  size_t subsystems, used, reserved;
+  Summary () : subsystems (0), used (0), reserved (0) { }
+  bool memory (const char * subsystem, size_t u, size_t r) {
+    cout << subsystem << ' ' << u << ' ' << r << endl << flush;
+    assert (u <= r);
+    subsystems++, used += u, reserved += r;
+    return true;
+  }
+};
+int main () {
+  CaDiCaL::Solver solver;
+  for (int i = 1; i <= 1000; i++)
+    for (int j = 1; j <= 3; j++)
+      solver.add ((i + j) % 1000 + 1), solver.add (-i), solver.add (0);
+  int res = solver.solve ();
+  assert (res == 10);
+  Summary summary;
+  bool completed = solver.traverse_memory_usage (summary);
+  assert (completed);
+  assert (summary.subsystems > 1);
+  assert (summary.used > 0);
+  assert (summary.reserved == solver.memory_usage ());
+  return 0;
+}
@@ -109,6 +109,11 @@ run terminate
 run cfreeze
 run traverse
 run apitrace
+run sparse
+run memory
+run backbone
+run threads
+run autarky
 
 #--------------------------------------------------------------------------#
 
@@ -0,0 +1,32 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+int main () {
+  CaDiCaL::Solver solver;
+  solver.set ("sparse", 1);
+  const int base = 1000000000;
+  // Implication chain over a few widely spread variables.
+  for (int i = 0; i < 100; i++) {
+    int a = base + 1000*i, b = a + 1000;
+    solver.add (-a), solver.add (b), solver.add (0);
+  }
+  solver.add (base), solver.add (0);
+  solver.freeze (base + 100000);
+  int res = solver.solve ();
+  cout << "solver.solve () = " << res << endl << flush;
+  assert (res == 10);
+  assert (solver.vars () == base + 100000);
+  for (int i = 0; i <= 100; i++)
+    assert (solver.val (base + 1000*i) > 0);
+  assert (solver.val (base + 1) < 0);
+  solver.assume (-(base + 100000));
+  res = solver.solve ();
+  cout << "solver.solve () = " << res << endl << flush;
+  assert (res == 20);
+  assert (solver.failed (-(base + 100000)));
+  return 0;
+}
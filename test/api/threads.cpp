@@ -0,0 +1,50 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+// Pseudo random 3-CNF formula with 'm' clauses over 'n' variables.
+static unsigned clauses (CaDiCaL::Solver & solver,
+                         int n, int m, unsigned seed) {
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < 3; j++) {
+      seed = seed * 1664525u + 1013904223u;
+      int lit = (seed >> 8) % n + 1;
+      seed = seed * 1664525u + 1013904223u;
+      solver.add (((seed >> 12) & 1) ? -lit : lit);
+      if (j == 2) solver.add (0);
+    }
+  return seed;
+}
+// Incremental solving with parallel phases ('threads' larger than one)
+// must give the same results as the sequential solver.
+int main () {
+  const int n = 200;
+  for (unsigned seed = 1; seed <= 4; seed++) {
+    CaDiCaL::Solver parallel, sequential;
+    parallel.set ("threads", 4);
+    parallel.set ("threadschunk", 1);
+    parallel.set ("check", 1);
+    sequential.set ("check", 1);
+    clauses (parallel, n, 7*n/2, seed);
+    unsigned next = clauses (sequential, n, 7*n/2, seed);
+    int res = parallel.simplify (2);
+    cout << "parallel.simplify () = " << res << endl << flush;
+    assert (!res || res == sequential.solve ());
+    for (int round = 0; round < 10; round++) {
+      int assumed = (next >> 8) % n + 1;
+      if (next & 1) assumed = -assumed;
+      parallel.assume (assumed);
+      sequential.assume (assumed);
+      res = parallel.solve ();
+      cout << "parallel.solve () = " << res << endl << flush;
+      assert (res == sequential.solve ());
+      if (res == 10) assert (parallel.val (assumed) > 0);
+      clauses (parallel, n, n/10, next);
+      next = clauses (sequential, n, n/10, next);
+    }
+  }
+  return 0;
+}
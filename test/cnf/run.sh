@@ -86,9 +86,12 @@ fi
 ok=0
 failed=0
 
+kind=core
+extra=""
+
 core () {
-  msg "running CNF test core ${HILITE}'$1'${NORMAL}"
-  prefix=$CADICALBUILD/test-cnf-core
+  msg "running CNF test $kind ${HILITE}'$1'${NORMAL}"
+  prefix=$CADICALBUILD/test-cnf-$kind
   cnf=../test/cnf/$1.cnf
   prf=$prefix-$1.prf
   log=$prefix-$1.log
@@ -106,7 +109,7 @@ core () {
   else
     proofopts=" $prf"
   fi
-  opts="$cnf --check$solopts$proofopts"
+  opts="$cnf --check$extra$solopts$proofopts"
   echo "$coresolver \\"
   echo "$opts"
   echo -n "# $2 ..."
@@ -207,6 +210,19 @@ run () {
   simp $*
 }
 
+# Same as 'core' but with several worker threads, which enables the
+# parallel versions of elimination, probing, subsumption, vivification and
+# garbage collection (all of them are sequential with '--threads=1').  The
+# minimum chunk size is set to one to use threads even for small ranges.
+
+threads () {
+  kind=threads
+  extra=" --threads=4 --threadschunk=1"
+  core $*
+  kind=core
+  extra=""
+}
+
 run empty 10
 run false 20
 
@@ -247,8 +263,14 @@ run full7 20
 run regr000 10
 run elimclash 20
 run elimredundant 10
+run elimsigsort 20
 
 run block0 10
+run autarky 10
+run congandclash 20
+run congxorclash 20
+run unhide 20
+run probetree 20
 
 run prime4 10
 run prime9 10
@@ -294,6 +316,7 @@ run ph3 20
 run ph4 20
 run ph5 20
 run ph6 20
+run cardph6 20
 
 run add4 20
 run add8 20
@@ -304,6 +327,13 @@ run add128 20
 
 run prime65537 20
 
+threads elimsigsort 20
+threads sqrt259081 10
+threads factor2708413pos 10
+threads add64 20
+threads add128 20
+threads prime65537 20
+
 #--------------------------------------------------------------------------#
 
 [ $ok -gt 0 ] && OK="$GOOD"